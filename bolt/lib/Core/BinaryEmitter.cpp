@@ -230,6 +230,11 @@ void BinaryEmitter::emitAll(StringRef OrgSecPrefix) {
   Streamer.setUseAssemblerInfoForParsing(true);
 }
 
+// Functions are emitted one after another into the single streamer. All of
+// them share BC.Ctx, so their labels, sections and fixups live in one
+// MCContext/MCAssembler, neither of which is thread-safe. Emitting fragments
+// in parallel would need a context per worker and a way to bind symbols across
+// contexts before layout, which MC does not provide.
 void BinaryEmitter::emitFunctions() {
   auto emit = [&](const std::vector<BinaryFunction *> &Functions) {
     const bool HasProfile = BC.NumProfiledFuncs > 0;
@@ -15,6 +15,7 @@
 #include "bolt/Core/BinaryBasicBlock.h"
 #include "bolt/Core/BinaryFunction.h"
 #include <unordered_map>
+#include <unordered_set>
 
 using namespace llvm;
 using namespace bolt;
@@ -226,6 +227,12 @@ void CacheMetrics::printAll(raw_ostream &OS,
   size_t HotCodeMinAddr = std::numeric_limits<size_t>::max();
   size_t HotCodeMaxAddr = 0;
 
+  // 2MB pages holding executed code. A block is attributed to the page it
+  // starts in.
+  const size_t HugePage2MB = 2 << 20;
+  std::unordered_set<size_t> ExecutedHugePages;
+  size_t ExecutedCodeSize = 0;
+
   for (BinaryFunction *BF : BFs) {
     NumFunctions++;
     if (BF->hasProfile())
@@ -243,6 +250,10 @@ void CacheMetrics::printAll(raw_ostream &OS,
         HotCodeMinAddr = std::min(HotCodeMinAddr, BBAddrMin);
         HotCodeMaxAddr = std::max(HotCodeMaxAddr, BBAddrMax);
       }
+      if (BB.getKnownExecutionCount() > 0 && BBAddrMax > BBAddrMin) {
+        ExecutedHugePages.insert(BBAddrMin / HugePage2MB);
+        ExecutedCodeSize += BBAddrMax - BBAddrMin;
+      }
     }
   }
 
@@ -259,11 +270,17 @@ void CacheMetrics::printAll(raw_ostream &OS,
   size_t HotCodeSize = HotCodeMaxAddr - HotCodeMinAddr;
   size_t TotalCodeSize = TotalCodeMaxAddr - TotalCodeMinAddr;
 
-  size_t HugePage2MB = 2 << 20;
   OS << format("  Hot code takes %.2lf%% of binary (%zu bytes out of %zu, "
                "%.2lf huge pages)\n",
                100.0 * HotCodeSize / TotalCodeSize, HotCodeSize, TotalCodeSize,
                double(HotCodeSize) / HugePage2MB);
+  if (!ExecutedHugePages.empty()) {
+    const size_t NumPages = ExecutedHugePages.size();
+    OS << format("  Executed code takes %zu bytes spread over %zu huge pages "
+                 "(%.2lf%% average utilization)\n",
+                 ExecutedCodeSize, NumPages,
+                 100.0 * ExecutedCodeSize / (NumPages * HugePage2MB));
+  }
 
   // Stats related to expected cache performance
   std::unordered_map<BinaryBasicBlock *, uint64_t> BBAddr;
@@ -16,6 +16,7 @@
 // - estimate temporal locality by looking at CFG?
 
 #include "bolt/Passes/ReorderData.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/MapVector.h"
 #include <algorithm>
 
@@ -230,8 +231,7 @@ void ReorderData::assignMemData(BinaryContext &BC) {
 std::pair<DataOrder, unsigned>
 ReorderData::sortedByFunc(BinaryContext &BC, const BinarySection &Section,
                           std::map<uint64_t, BinaryFunction> &BFs) const {
-  std::map<BinaryData *, std::set<BinaryFunction *>> BDtoFunc;
-  std::map<BinaryData *, uint64_t> BDtoFuncCount;
+  DenseMap<BinaryData *, uint64_t> BDtoFuncCount;
 
   auto dataUses = [&BC](const BinaryFunction &BF, bool OnlyHot) {
     std::set<BinaryData *> Uses;
@@ -262,10 +262,8 @@ ReorderData::sortedByFunc(BinaryContext &BC, const BinarySection &Section,
     BinaryFunction &BF = Entry.second;
     if (BF.hasValidProfile()) {
       for (BinaryData *BD : dataUses(BF, true)) {
-        if (!BC.getFunctionForSymbol(BD->getSymbol())) {
-          BDtoFunc[BD->getAtomicRoot()].insert(&BF);
+        if (!BC.getFunctionForSymbol(BD->getSymbol()))
           BDtoFuncCount[BD->getAtomicRoot()] += BF.getKnownExecutionCount();
-        }
       }
     }
   }
@@ -277,8 +275,8 @@ ReorderData::sortedByFunc(BinaryContext &BC, const BinarySection &Section,
       Order,
       [&](const DataOrder::value_type &A, const DataOrder::value_type &B) {
         // Total execution counts of functions referencing BD.
-        const uint64_t ACount = BDtoFuncCount[A.first];
-        const uint64_t BCount = BDtoFuncCount[B.first];
+        const uint64_t ACount = BDtoFuncCount.lookup(A.first);
+        const uint64_t BCount = BDtoFuncCount.lookup(B.first);
         // Weight by number of loads/data size.
         const double AWeight = double(A.second) / A.first->getSize();
         const double BWeight = double(B.second) / B.first->getSize();
@@ -290,7 +288,7 @@ ReorderData::sortedByFunc(BinaryContext &BC, const BinarySection &Section,
       });
 
   for (unsigned Idx = 0; Idx < Order.size(); ++Idx) {
-    if (!BDtoFuncCount[Order[Idx].first]) {
+    if (!BDtoFuncCount.lookup(Order[Idx].first)) {
       SplitPoint = Idx;
       break;
     }
@@ -1540,6 +1540,11 @@ std::error_code DataAggregator::parseBranchEvents() {
   uint64_t NumSamplesNoLBR = 0;
   bool NeedsSkylakeFix = false;
 
+  // Samples are parsed serially: the parser keeps its cursor (ParsingBuf, Line,
+  // Col) in the aggregator, and the pid filter in parseBranchSample depends on
+  // the mmap and task events parsed before. The perf script processes are all
+  // launched up front in start(), so perf decodes branch events while the mmap
+  // and task events are being parsed here.
   while (hasData() && NumTotalSamples < opts::MaxSamples) {
     ++NumTotalSamples;
 
@@ -1006,6 +1006,12 @@ bool YAMLProfileReader::inferStaleProfile(
   if (!BF.hasCFG())
     return false;
 
+  // Functions that are too large for inference are rejected by
+  // canApplyInference anyway; bail out before paying for block hashing and
+  // matching. The flow function adds an artificial source and sink.
+  if (BF.getLayout().block_size() + 2 > opts::StaleMatchingMaxFuncSize)
+    return false;
+
   LLVM_DEBUG(dbgs() << "BOLT-INFO: applying profile inference for "
                     << "\"" << BF.getPrintName() << "\"\n");
 
@@ -3407,6 +3407,9 @@ void RewriteInstance::disassembleFunctions() {
         reinterpret_cast<const uint8_t *>(InputFile->getData().data());
     Function.setFileOffset(FunctionData->begin() - FileBegin);
 
+    // Functions that are not processed, e.g. cold ones in lite mode, are kept
+    // as raw bytes: only their external references are scanned so that they
+    // can be patched or relocated, and no MCInst or CFG state is built.
     if (!shouldDisassemble(Function)) {
       NamedRegionTimer T("scan", "scan functions", "buildfuncs",
                          "Scan Binary Functions", opts::TimeBuild);
@@ -745,13 +745,15 @@ buildPreamble(PathRef FileName, CompilerInvocation CI,
 bool isPreambleCompatible(const PreambleData &Preamble,
                           const ParseInputs &Inputs, PathRef FileName,
                           const CompilerInvocation &CI) {
+  // Comparing the commands is cheap; do it before lexing the preamble bounds
+  // and statting every file the preamble depends on.
+  if (!compileCommandsAreEqual(Inputs.CompileCommand, Preamble.CompileCommand))
+    return false;
   auto ContentsBuffer =
       llvm::MemoryBuffer::getMemBuffer(Inputs.Contents, FileName);
   auto Bounds = ComputePreambleBounds(CI.getLangOpts(), *ContentsBuffer, 0);
   auto VFS = Inputs.TFS->view(Inputs.CompileCommand.Directory);
-  return compileCommandsAreEqual(Inputs.CompileCommand,
-                                 Preamble.CompileCommand) &&
-         Preamble.Preamble.CanReuse(CI, *ContentsBuffer, Bounds, *VFS) &&
+  return Preamble.Preamble.CanReuse(CI, *ContentsBuffer, Bounds, *VFS) &&
          (!Preamble.RequiredModules ||
           Preamble.RequiredModules->canReuse(CI, VFS));
 }
@@ -11,6 +11,7 @@
 #include "support/Logger.h"
 #include "support/Trace.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -28,8 +29,11 @@ namespace clangd {
 bool BackgroundIndexRebuilder::enoughTUsToRebuild() const {
   if (!ActiveVersion)                         // never built
     return IndexedTUs == TUsBeforeFirstBuild; // use low threshold
-  // rebuild if we've reached the (higher) threshold
-  return IndexedTUs >= IndexedTUsAtLastRebuild + TUsBeforeRebuild;
+  // rebuild if we've reached the (higher) threshold, which keeps the total
+  // merge work roughly linear in the number of TUs as the index grows.
+  unsigned Threshold = std::max(TUsBeforeRebuild,
+                                IndexedTUsAtLastRebuild / RebuildGrowthDivisor);
+  return IndexedTUs >= IndexedTUsAtLastRebuild + Threshold;
 }
 
 void BackgroundIndexRebuilder::indexedTU() {
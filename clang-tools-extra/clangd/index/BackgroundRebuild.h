@@ -72,6 +72,9 @@ public:
   // Thresholds for rebuilding as TUs get indexed. Exposed for testing.
   const unsigned TUsBeforeFirstBuild; // Typically one per worker thread.
   const unsigned TUsBeforeRebuild = 100;
+  // Each rebuild merges every shard, so on large projects the interval also
+  // grows with the index: wait for at least 1/RebuildGrowthDivisor more TUs.
+  const unsigned RebuildGrowthDivisor = 10;
 
 private:
   // Run Check under the lock, and rebuild if it returns true.
@@ -730,6 +730,9 @@ std::unique_ptr<SymbolIndex> loadIndex(llvm::StringRef SymbolFilename,
       return nullptr;
     }
   }
+  // Everything read from the file now lives in the slabs' own arenas, so drop
+  // the file mapping before building the index rather than holding both.
+  Buffer->reset();
 
   size_t NumSym = Symbols.size();
   size_t NumRefs = Refs.numRefs();
@@ -731,6 +731,21 @@ TEST_F(BackgroundIndexRebuilderTest, IndexingTUs) {
   EXPECT_TRUE(checkRebuild([&] { Rebuilder.indexedTU(); }));
 }
 
+TEST_F(BackgroundIndexRebuilderTest, RebuildIntervalGrowsWithIndex) {
+  unsigned LastRebuild = 0, LastGap = 0;
+  for (unsigned I = 1; I <= 20 * Rebuilder.TUsBeforeRebuild; ++I) {
+    if (!checkRebuild([&] { Rebuilder.indexedTU(); }))
+      continue;
+    if (LastRebuild)
+      LastGap = I - LastRebuild;
+    LastRebuild = I;
+  }
+  // Once the index is large, the interval is proportional to its size.
+  EXPECT_GT(LastGap, Rebuilder.TUsBeforeRebuild);
+  EXPECT_EQ(LastGap,
+            (LastRebuild - LastGap) / Rebuilder.RebuildGrowthDivisor);
+}
+
 TEST_F(BackgroundIndexRebuilderTest, LoadingShards) {
   Rebuilder.startLoading();
   Rebuilder.loadedShard(10);
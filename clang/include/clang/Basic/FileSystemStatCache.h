@@ -32,6 +32,13 @@ namespace clang {
 /// Abstract interface for introducing a FileManager cache for 'stat'
 /// system calls, which is used by precompiled and pretokenized headers to
 /// improve performance.
+///
+/// FileManager already remembers every lookup, including failed ones, for the
+/// lifetime of a compilation, so a cache only pays off when its contents come
+/// from elsewhere. Results imported from outside the process cannot be trusted
+/// without revalidating them, which costs the same 'stat' they were meant to
+/// save; the exception is a build system that guarantees inputs do not change,
+/// as the dependency scanner's shared file system cache does.
 class FileSystemStatCache {
   virtual void anchor();
 
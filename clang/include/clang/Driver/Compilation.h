@@ -126,6 +126,9 @@ class Compilation {
   /// Whether to keep temporary files regardless of -save-temps.
   bool ForceKeepTempFiles = false;
 
+  /// The maximum number of jobs to execute at the same time.
+  unsigned NumParallelJobs = 1;
+
 public:
   Compilation(const Driver &D, const ToolChain &DefaultToolChain,
               llvm::opt::InputArgList *Args,
@@ -230,6 +233,11 @@ public:
     PostCallback = CB;
   }
 
+  /// Allow up to \p N jobs that don't depend on each other to be executed at
+  /// the same time.
+  void setNumParallelJobs(unsigned N) { NumParallelJobs = N; }
+  unsigned getNumParallelJobs() const { return NumParallelJobs; }
+
   /// Returns the sysroot path.
   StringRef getSysRoot() const;
 
@@ -339,6 +347,17 @@ public:
   /// of three. The inferior process's stdin(0), stdout(1), and stderr(2) will
   /// be redirected to the corresponding paths, if provided (not std::nullopt).
   void Redirect(ArrayRef<std::optional<StringRef>> Redirects);
+
+private:
+  /// Return true if \p Jobs can be executed by ExecuteJobsInParallel.
+  bool canExecuteJobsInParallel(const JobList &Jobs) const;
+
+  /// Execute \p Jobs like ExecuteJobs does, running up to NumParallelJobs of
+  /// them at the same time. The output of each job, the driver diagnostics
+  /// and \p FailingCommands are the same as if they had run one by one.
+  void ExecuteJobsInParallel(
+      const JobList &Jobs,
+      SmallVectorImpl<std::pair<int, const Command *>> &FailingCommands) const;
 };
 
 } // namespace driver
@@ -11259,6 +11259,10 @@ public:
   /// The number of SFINAE diagnostics that have been trapped.
   unsigned NumSFINAEErrors;
 
+  /// The number of class definitions instantiated via InstantiateClass, as
+  /// reported by -print-stats.
+  unsigned NumClassInstantiations = 0;
+
   ArrayRef<sema::FunctionScopeInfo *> getFunctionScopes() const {
     return llvm::ArrayRef(FunctionScopes.begin() + FunctionScopesStart,
                           FunctionScopes.end());
@@ -1154,6 +1154,17 @@ private:
   /// The number of lookups into identifier tables that succeed.
   unsigned NumIdentifierLookupHits = 0;
 
+  /// The number of times all external specializations of a template were
+  /// requested at once.
+  unsigned NumFullSpecializationLoads = 0;
+
+  /// The number of times external specializations were looked up by their
+  /// template arguments.
+  unsigned NumSpecializationLookups = 0;
+
+  /// The number of specializations deserialized by either kind of load.
+  unsigned NumSpecializationsRead = 0;
+
   /// The number of selectors that have been read.
   unsigned NumSelectorsRead = 0;
 
@@ -151,6 +151,14 @@ using CachedRealPath = llvm::ErrorOr<std::string>;
 ///
 /// It is sharded based on the hash of the key to reduce the lock contention for
 /// the worker threads.
+///
+/// The cache lives only as long as the owning \c DependencyScanningService.
+/// Entries are keyed by path and validated by nothing but the initial 'stat',
+/// which is only sound while the build guarantees its inputs do not change.
+/// The directive tokens themselves are plain offsets into the original buffer
+/// and could be serialized, but reusing them in a later invocation would need
+/// the file to be read and hashed first, so only the scan itself would be
+/// saved, not the I/O.
 class DependencyScanningFilesystemSharedCache {
 public:
   struct CacheShard {
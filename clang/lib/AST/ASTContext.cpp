@@ -1071,6 +1071,9 @@ void ASTContext::PrintStats() const {
     ExternalSource->PrintStats();
   }
 
+  if (InterpContext)
+    InterpContext->printStats();
+
   BumpAlloc.PrintStats();
 }
 
@@ -32,6 +32,11 @@ Context::Context(ASTContext &Ctx) : Ctx(Ctx), P(new Program(*this)) {
 
 Context::~Context() {}
 
+void Context::printStats() const {
+  llvm::errs() << "\n*** Bytecode Interpreter Stats:\n";
+  P->printStats(llvm::errs());
+}
+
 bool Context::isPotentialConstantExpr(State &Parent, const FunctionDecl *FD) {
   assert(Stk.empty());
 
@@ -46,6 +46,9 @@ public:
   /// Cleans up the constexpr VM.
   ~Context();
 
+  /// Prints statistics about the bytecode compiled in this context.
+  void printStats() const;
+
   /// Checks if a function is a potential constant expression.
   bool isPotentialConstantExpr(State &Parent, const FunctionDecl *FnDecl);
 
@@ -306,8 +306,14 @@ private:
   unsigned Immediate : 1;
   LLVM_PREFERRED_TYPE(bool)
   unsigned Constexpr : 1;
+  /// Number of frames created for this function, for -print-stats.
+  mutable unsigned NumCalls = 0;
 
 public:
+  /// Records that a frame for this function was created.
+  void noteCall() const { ++NumCalls; }
+  unsigned getNumCalls() const { return NumCalls; }
+
   /// Dumps the disassembled bytecode to \c llvm::errs().
   void dump() const;
   void dump(llvm::raw_ostream &OS) const;
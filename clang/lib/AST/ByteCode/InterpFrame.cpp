@@ -34,6 +34,8 @@ InterpFrame::InterpFrame(InterpState &S, const Function *Func,
   if (!Func)
     return;
 
+  Func->noteCall();
+
   unsigned FrameSize = Func->getFrameSize();
   if (FrameSize == 0)
     return;
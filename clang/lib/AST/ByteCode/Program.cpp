@@ -482,3 +482,32 @@ Descriptor *Program::createDescriptor(const DeclTy &D, const Type *Ty,
 
   return nullptr;
 }
+
+void Program::printStats(llvm::raw_ostream &OS) const {
+  SmallVector<const Function *, 32> Called;
+  uint64_t TotalCalls = 0;
+  auto Collect = [&](const Function *F) {
+    if (!F->getNumCalls())
+      return;
+    TotalCalls += F->getNumCalls();
+    Called.push_back(F);
+  };
+  for (const auto &[FD, F] : Funcs)
+    Collect(F.get());
+  for (const auto &F : AnonFuncs)
+    Collect(F.get());
+
+  OS << "  " << (Funcs.size() + AnonFuncs.size())
+     << " bytecode functions compiled, " << Called.size() << " called "
+     << TotalCalls << " times.\n";
+
+  // Report the hottest functions; ties are broken by name so that the output
+  // does not depend on DenseMap iteration order.
+  llvm::sort(Called, [](const Function *A, const Function *B) {
+    if (A->getNumCalls() != B->getNumCalls())
+      return A->getNumCalls() > B->getNumCalls();
+    return A->getName() < B->getName();
+  });
+  for (const Function *F : ArrayRef(Called).take_front(10))
+    OS << "    " << F->getNumCalls() << " calls: " << F->getName() << "\n";
+}
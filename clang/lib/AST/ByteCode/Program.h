@@ -238,6 +238,9 @@ private:
   unsigned CurrentDeclaration = NoDeclaration;
 
 public:
+  /// Prints the number of compiled functions and the most called ones.
+  void printStats(llvm::raw_ostream &OS) const;
+
   /// Dumps the disassembled bytecode to \c llvm::errs().
   void dump() const;
   void dump(llvm::raw_ostream &OS) const;
@@ -27,6 +27,7 @@
 #include "llvm/Support/Timer.h"
 #include <deque>
 #include <memory>
+#include <optional>
 #include <set>
 
 namespace clang {
@@ -1049,16 +1050,25 @@ private:
     const bool EnableCheckProfiling = Options.CheckProfiling.has_value();
     TimeBucketRegion Timer;
     auto &Matchers = this->Matchers->DeclOrStmt;
+    ParentMapContext &PMC = getASTContext().getParentMapContext();
+    // Whether the node is hidden by TK_IgnoreUnlessSpelledInSource. Only that
+    // traversal kind can skip a node, so compute this at most once per node
+    // rather than once per matcher.
+    std::optional<bool> IsIgnored;
     for (unsigned short I : Filter) {
       auto &MP = Matchers[I];
       if (EnableCheckProfiling)
         Timer.setBucket(&TimeByBucket[MP.second->getID()]);
       BoundNodesTreeBuilder Builder;
 
-      {
-        TraversalKindScope RAII(getASTContext(), MP.first.getTraversalKind());
-        if (getASTContext().getParentMapContext().traverseIgnored(DynNode) !=
-            DynNode)
+      TraversalKind TK =
+          MP.first.getTraversalKind().value_or(PMC.getTraversalKind());
+      if (TK != TK_AsIs) {
+        if (!IsIgnored) {
+          TraversalKindScope RAII(getASTContext(), TK);
+          IsIgnored = PMC.traverseIgnored(DynNode) != DynNode;
+        }
+        if (*IsIgnored)
           continue;
       }
 
@@ -3433,6 +3433,12 @@ void CodeGenModule::EmitDeferred() {
   std::vector<GlobalDecl> CurDeclsToEmit;
   CurDeclsToEmit.swap(DeferredDeclsToEmit);
 
+  // These are emitted one at a time on purpose. Emitting a body is not
+  // confined to its own llvm::Function: it creates or looks up globals through
+  // GetAddrOfGlobal and the mangled-name tables, fills ASTContext's lazily
+  // computed layout and mangling caches, uniques constants and types in the
+  // shared LLVMContext, and may enqueue further deferred decls whose order
+  // determines the order of the output module.
   for (GlobalDecl &D : CurDeclsToEmit) {
     // Functions declared with the sycl_kernel_entry_point attribute are
     // emitted normally during host compilation. During device compilation,
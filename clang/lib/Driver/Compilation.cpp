@@ -14,13 +14,21 @@
 #include "clang/Driver/Options.h"
 #include "clang/Driver/ToolChain.h"
 #include "clang/Driver/Util.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/Option/ArgList.h"
 #include "llvm/Option/OptSpecifier.h"
 #include "llvm/Option/Option.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/TargetParser/Triple.h"
 #include <cassert>
+#include <condition_variable>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -237,9 +245,208 @@ static bool InputsOk(const Command &C,
   return !ActionFailed(&C.getSource(), FailingCommands);
 }
 
+bool Compilation::canExecuteJobsInParallel(const JobList &Jobs) const {
+  if (NumParallelJobs <= 1 || Jobs.size() <= 1 || ForDiagnostics ||
+      !llvm::llvm_is_multithreaded())
+    return false;
+  // The cl driver stops at the first failure, and prints the name of each file
+  // as it is compiled.
+  if (TheDriver.IsCLMode())
+    return false;
+  // Keep the commands printed by -v and CC_PRINT_OPTIONS in order with the
+  // output of the commands.
+  if (TheDriver.CCPrintOptions || getArgs().hasArg(options::OPT_v))
+    return false;
+  // The output of each job is captured to be printed in order.
+  if (!Redirects.empty())
+    return false;
+  // Commands executed in this process, such as the integrated cc1, are not
+  // thread-safe.
+  if (llvm::any_of(Jobs, [](const Command &C) { return C.InProcess; }))
+    return false;
+  // Jobs can also depend on each other only through files, which the action
+  // graph doesn't show: a precompiled header or module built here may be
+  // found by other jobs through -include, -fmodule-file or the search paths.
+  llvm::SmallPtrSet<const Action *, 16> Visited;
+  SmallVector<const Action *, 16> Worklist;
+  for (const Command &C : Jobs)
+    Worklist.push_back(&C.getSource());
+  while (!Worklist.empty()) {
+    const Action *A = Worklist.pop_back_val();
+    if (!Visited.insert(A).second)
+      continue;
+    if (isa<PrecompileJobAction>(A))
+      return false;
+    llvm::append_range(Worklist, A->inputs());
+  }
+  return true;
+}
+
+/// Print the output of a job captured in \p Path to \p OS, if any, and remove
+/// the file.
+static void takeCapturedOutput(StringRef Path, raw_ostream *OS) {
+  if (Path.empty())
+    return;
+  if (OS) {
+    if (auto Buf = llvm::MemoryBuffer::getFile(Path))
+      *OS << (*Buf)->getBuffer();
+    OS->flush();
+  }
+  llvm::sys::fs::remove(Path);
+}
+
+/// For each job, compute the earlier jobs whose outputs it consumes.
+static std::vector<SmallVector<size_t, 2>>
+getJobDependencies(ArrayRef<const Command *> Commands) {
+  // A single action can produce several jobs, e.g. the compile job and the
+  // job that splits the debug info collapsed into it.
+  llvm::DenseMap<const Action *, SmallVector<size_t, 1>> JobsOfAction;
+  for (auto [I, C] : llvm::enumerate(Commands))
+    JobsOfAction[&C->getSource()].push_back(I);
+
+  std::vector<SmallVector<size_t, 2>> Deps(Commands.size());
+  for (auto [I, C] : llvm::enumerate(Commands)) {
+    llvm::SmallPtrSet<const Action *, 16> Visited;
+    SmallVector<const Action *, 16> Worklist = {&C->getSource()};
+    while (!Worklist.empty()) {
+      const Action *A = Worklist.pop_back_val();
+      if (!Visited.insert(A).second)
+        continue;
+      auto It = JobsOfAction.find(A);
+      if (It != JobsOfAction.end())
+        for (size_t J : It->second)
+          if (J < I)
+            Deps[I].push_back(J);
+      llvm::append_range(Worklist, A->inputs());
+    }
+  }
+  return Deps;
+}
+
+void Compilation::ExecuteJobsInParallel(
+    const JobList &Jobs, FailingCommandList &FailingCommands) const {
+  SmallVector<const Command *, 8> Commands;
+  for (const Command &C : Jobs)
+    Commands.push_back(&C);
+  std::vector<SmallVector<size_t, 2>> Deps = getJobDependencies(Commands);
+
+  enum class JobState { Pending, Running, Finished, Skipped };
+  struct JobResult {
+    JobState State = JobState::Pending;
+    int Res = 0;
+    bool ExecutionFailed = false;
+    std::string Error;
+    /// Where the standard output and error of the job are captured, if
+    /// anywhere.
+    SmallString<128> StdoutPath;
+    SmallString<128> StderrPath;
+
+    bool failed() const {
+      return State == JobState::Skipped || ExecutionFailed || Res != 0;
+    }
+  };
+  std::vector<JobResult> Results(Commands.size());
+
+  std::mutex Mutex;
+  std::condition_variable JobFinished;
+  size_t NumFinished = 0;
+  // The jobs run in other processes; the threads only wait for them. Sharing
+  // the jobserver of the build keeps them from oversubscribing the machine.
+  llvm::DefaultThreadPool Pool(llvm::jobserver_concurrency(NumParallelJobs));
+
+  // Report the jobs in order, exactly as ExecuteJobs would have: a job that
+  // ExecuteJobs would have skipped because of an earlier failure may already
+  // have run, in which case its results are dropped.
+  auto Report = [&](size_t I) {
+    const Command &C = *Commands[I];
+    JobResult &R = Results[I];
+    bool Ran = R.State == JobState::Finished && InputsOk(C, FailingCommands);
+    takeCapturedOutput(R.StdoutPath, Ran ? &llvm::outs() : nullptr);
+    takeCapturedOutput(R.StderrPath, Ran ? &llvm::errs() : nullptr);
+    if (!Ran)
+      return;
+
+    if (PostCallback)
+      PostCallback(C, R.Res);
+    if (!R.Error.empty()) {
+      assert(R.Res && "Error string set with 0 result code!");
+      getDriver().Diag(diag::err_drv_command_failure) << R.Error;
+    }
+    const Command *FailingCommand = R.Res ? &C : nullptr;
+    if (int Res = R.ExecutionFailed ? 1 : R.Res)
+      FailingCommands.push_back(std::make_pair(Res, FailingCommand));
+  };
+
+  size_t NextToReport = 0;
+  std::unique_lock<std::mutex> Lock(Mutex);
+  while (NextToReport != Commands.size()) {
+    // Start every job whose dependencies have finished. Dependencies always
+    // come first, so a single pass also skips chains of dependent jobs.
+    for (size_t I = NextToReport, E = Commands.size(); I != E; ++I) {
+      JobResult &R = Results[I];
+      if (R.State != JobState::Pending)
+        continue;
+      if (llvm::any_of(Deps[I],
+                       [&](size_t D) { return Results[D].failed(); }) ||
+          !InputsOk(*Commands[I], FailingCommands)) {
+        R.State = JobState::Skipped;
+        continue;
+      }
+      if (llvm::any_of(Deps[I], [&](size_t D) {
+            return Results[D].State != JobState::Finished;
+          }))
+        continue;
+
+      R.State = JobState::Running;
+      // Without a file to capture it to, the output goes straight through.
+      if (llvm::sys::fs::createTemporaryFile("clang-job", "stdout",
+                                             R.StdoutPath))
+        R.StdoutPath.clear();
+      if (llvm::sys::fs::createTemporaryFile("clang-job", "stderr",
+                                             R.StderrPath))
+        R.StderrPath.clear();
+      Pool.async([&, I] {
+        JobResult &Result = Results[I];
+        std::optional<StringRef> JobRedirects[] = {std::nullopt, std::nullopt,
+                                                   std::nullopt};
+        if (!Result.StdoutPath.empty())
+          JobRedirects[1] = Result.StdoutPath.str();
+        if (!Result.StderrPath.empty())
+          JobRedirects[2] = Result.StderrPath.str();
+        std::string Error;
+        bool ExecutionFailed = false;
+        int Res = Commands[I]->Execute(JobRedirects, &Error, &ExecutionFailed);
+
+        std::lock_guard<std::mutex> Guard(Mutex);
+        Result.Res = Res;
+        Result.ExecutionFailed = ExecutionFailed;
+        Result.Error = std::move(Error);
+        Result.State = JobState::Finished;
+        ++NumFinished;
+        JobFinished.notify_one();
+      });
+    }
+
+    while (NextToReport != Commands.size() &&
+           (Results[NextToReport].State == JobState::Finished ||
+            Results[NextToReport].State == JobState::Skipped))
+      Report(NextToReport++);
+    if (NextToReport == Commands.size())
+      break;
+
+    size_t LastNumFinished = NumFinished;
+    JobFinished.wait(Lock, [&] { return NumFinished != LastNumFinished; });
+  }
+}
+
 void Compilation::ExecuteJobs(const JobList &Jobs,
                               FailingCommandList &FailingCommands,
                               bool LogOnly) const {
+  if (!LogOnly && canExecuteJobsInParallel(Jobs)) {
+    ExecuteJobsInParallel(Jobs, FailingCommands);
+    return;
+  }
+
   // According to UNIX standard, driver need to continue compiling all the
   // inputs on the command line even one of them failed.
   // In all but CLMode, execute all the jobs unless the necessary inputs for the
@@ -1813,6 +1813,15 @@ Compilation *Driver::BuildCompilation(ArrayRef<const char *> ArgList) {
   if (!HandleImmediateArgs(*C))
     return C;
 
+  if (Arg *A = C->getArgs().getLastArg(options::OPT_parallel_jobs_EQ)) {
+    unsigned NumJobs = 0;
+    if (StringRef(A->getValue()).getAsInteger(10, NumJobs) || NumJobs == 0)
+      Diag(diag::err_drv_invalid_int_value)
+          << A->getAsString(C->getArgs()) << A->getValue();
+    else
+      C->setNumParallelJobs(NumJobs);
+  }
+
   // Construct the list of inputs.
   InputList Inputs;
   BuildInputs(C->getDefaultToolChain(), *TranslatedArgs, Inputs);
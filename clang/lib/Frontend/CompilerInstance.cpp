@@ -1487,9 +1487,14 @@ static bool compileModuleAndReadASTImpl(CompilerInstance &ImportingInstance,
 /// multiple instances will compete to create the same module.  On timeout,
 /// deletes the lock file in order to avoid deadlock from crashing processes or
 /// bugs in the lock file manager.
+///
+/// \p ModuleFileWasMissing tells whether there was no module file at all when
+/// the importer last looked, in which case another instance may have built it
+/// since then.
 static bool compileModuleAndReadASTBehindLock(
     CompilerInstance &ImportingInstance, SourceLocation ImportLoc,
-    SourceLocation ModuleNameLoc, Module *Module, StringRef ModuleFileName) {
+    SourceLocation ModuleNameLoc, Module *Module, StringRef ModuleFileName,
+    bool ModuleFileWasMissing) {
   DiagnosticsEngine &Diags = ImportingInstance.getDiagnostics();
 
   Diags.Report(ModuleNameLoc, diag::remark_module_lock)
@@ -1511,7 +1516,19 @@ static bool compileModuleAndReadASTBehindLock(
                                          ModuleNameLoc, Module, ModuleFileName);
     }
     if (Owned) {
-      // We're responsible for building the module ourselves.
+      // We're responsible for building the module ourselves, unless another
+      // instance built it and released the lock between our lookup and now.
+      // Reading a module file that is still missing is only a failed stat.
+      if (ModuleFileWasMissing) {
+        bool OutOfDate = false;
+        bool Missing = false;
+        if (readASTAfterCompileModule(ImportingInstance, ImportLoc,
+                                      ModuleNameLoc, Module, ModuleFileName,
+                                      &OutOfDate, &Missing))
+          return true;
+        if (!OutOfDate && !Missing)
+          return false;
+      }
       return compileModuleAndReadASTImpl(ImportingInstance, ImportLoc,
                                          ModuleNameLoc, Module, ModuleFileName);
     }
@@ -1557,13 +1574,14 @@ static bool compileModuleAndReadASTBehindLock(
 static bool compileModuleAndReadAST(CompilerInstance &ImportingInstance,
                                     SourceLocation ImportLoc,
                                     SourceLocation ModuleNameLoc,
-                                    Module *Module, StringRef ModuleFileName) {
+                                    Module *Module, StringRef ModuleFileName,
+                                    bool ModuleFileWasMissing) {
   return ImportingInstance.getInvocation()
                  .getFrontendOpts()
                  .BuildingImplicitModuleUsesLock
-             ? compileModuleAndReadASTBehindLock(ImportingInstance, ImportLoc,
-                                                 ModuleNameLoc, Module,
-                                                 ModuleFileName)
+             ? compileModuleAndReadASTBehindLock(
+                   ImportingInstance, ImportLoc, ModuleNameLoc, Module,
+                   ModuleFileName, ModuleFileWasMissing)
              : compileModuleAndReadASTImpl(ImportingInstance, ImportLoc,
                                            ModuleNameLoc, Module,
                                            ModuleFileName);
@@ -1921,13 +1939,13 @@ ModuleLoadResult CompilerInstance::findOrCompileModuleAndReadAST(
                           : Source == MS_PrebuiltModulePath
                                 ? 0
                                 : ASTReader::ARR_ConfigurationMismatch;
-  switch (getASTReader()->ReadAST(ModuleFilename,
-                                  Source == MS_PrebuiltModulePath
-                                      ? serialization::MK_PrebuiltModule
-                                      : Source == MS_ModuleBuildPragma
-                                            ? serialization::MK_ExplicitModule
-                                            : serialization::MK_ImplicitModule,
-                                  ImportLoc, ARRFlags)) {
+  ASTReader::ASTReadResult ReadResult = getASTReader()->ReadAST(
+      ModuleFilename,
+      Source == MS_PrebuiltModulePath  ? serialization::MK_PrebuiltModule
+      : Source == MS_ModuleBuildPragma ? serialization::MK_ExplicitModule
+                                       : serialization::MK_ImplicitModule,
+      ImportLoc, ARRFlags);
+  switch (ReadResult) {
   case ASTReader::Success: {
     if (M)
       return M;
@@ -2016,7 +2034,8 @@ ModuleLoadResult CompilerInstance::findOrCompileModuleAndReadAST(
 
   // Try to compile and then read the AST.
   if (!compileModuleAndReadAST(*this, ImportLoc, ModuleNameLoc, M,
-                               ModuleFilename)) {
+                               ModuleFilename,
+                               ReadResult == ASTReader::Missing)) {
     assert(getDiagnostics().hasErrorOccurred() &&
            "undiagnosed error in compileModuleAndReadAST");
     FailedModules.insert(ModuleName);
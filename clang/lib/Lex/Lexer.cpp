@@ -49,6 +49,17 @@
 #include <nmmintrin.h>
 #endif
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+
+/// Compress a NEON comparison result (0x00 or 0xff per byte) into a 64-bit mask
+/// with four bits per byte, so the first set byte is at countr_zero(Mask) / 4.
+static inline uint64_t getNEONByteMask(uint8x16_t V) {
+  uint8x8_t Narrowed = vshrn_n_u16(vreinterpretq_u16_u8(V), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(Narrowed), 0);
+}
+#endif
+
 using namespace clang;
 
 //===----------------------------------------------------------------------===//
@@ -1946,6 +1957,29 @@ fastParseASCIIIdentifier(const char *CurPtr,
       continue;
     return CurPtr;
   }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  constexpr ssize_t BytesPerRegister = 16;
+
+  while (LLVM_LIKELY(BufferEnd - CurPtr >= BytesPerRegister)) {
+    uint8x16_t Cv = vld1q_u8((const uint8_t *)CurPtr);
+
+    // [_A-Za-z0-9]: setting bit 5 folds upper case onto lower case without
+    // moving any other byte into the 'a'..'z' range.
+    uint8x16_t Lower = vorrq_u8(Cv, vdupq_n_u8(0x20));
+    uint8x16_t IsAlpha =
+        vcltq_u8(vsubq_u8(Lower, vdupq_n_u8('a')), vdupq_n_u8(26));
+    uint8x16_t IsDigit =
+        vcltq_u8(vsubq_u8(Cv, vdupq_n_u8('0')), vdupq_n_u8(10));
+    uint8x16_t IsUnderscore = vceqq_u8(Cv, vdupq_n_u8('_'));
+    uint8x16_t IsIdent = vorrq_u8(vorrq_u8(IsAlpha, IsDigit), IsUnderscore);
+
+    uint64_t Mask = getNEONByteMask(vmvnq_u8(IsIdent));
+    if (Mask == 0) {
+      CurPtr += BytesPerRegister;
+      continue;
+    }
+    return CurPtr + llvm::countr_zero(Mask) / 4;
+  }
 #endif
 
   unsigned char C = *CurPtr;
@@ -2940,6 +2974,22 @@ bool Lexer::SkipBlockComment(Token &Result, const char *CurPtr,
         }
         CurPtr += 16;
       }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+      uint8x16_t Slashes = vdupq_n_u8('/');
+      while (CurPtr + 16 < BufferEnd) {
+        uint8x16_t Chunk = vld1q_u8((const uint8_t *)CurPtr);
+        if (LLVM_UNLIKELY(vmaxvq_u8(Chunk) >= 0x80))
+          goto MultiByteUTF8;
+        // look for slashes
+        uint64_t Mask = getNEONByteMask(vceqq_u8(Chunk, Slashes));
+        if (Mask != 0) {
+          // Adjust the pointer to point directly after the first slash, as in
+          // the SSE2 path above.
+          CurPtr += llvm::countr_zero(Mask) / 4 + 1;
+          goto FoundSlash;
+        }
+        CurPtr += 16;
+      }
 #elif __ALTIVEC__
       __vector unsigned char LongUTF = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
                                         0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
@@ -673,6 +673,8 @@ void Sema::addExternalSource(ExternalSemaSource *E) {
 void Sema::PrintStats() const {
   llvm::errs() << "\n*** Semantic Analysis Stats:\n";
   llvm::errs() << NumSFINAEErrors << " SFINAE diagnostics trapped.\n";
+  llvm::errs() << NumClassInstantiations
+               << " class definitions instantiated.\n";
 
   BumpAlloc.PrintStats();
   AnalysisWarnings.PrintStats();
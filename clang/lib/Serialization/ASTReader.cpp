@@ -8342,12 +8342,14 @@ bool ASTReader::LoadExternalSpecializationsImpl(SpecLookupTableTy &SpecLookups,
   // the lookup table.
   SpecLookups.erase(It);
 
+  ++NumFullSpecializationLoads;
   bool NewSpecsFound = false;
   Deserializing LookupResults(this);
   for (auto &Info : Infos) {
     if (GetExistingDecl(Info))
       continue;
     NewSpecsFound = true;
+    ++NumSpecializationsRead;
     GetDecl(Info);
   }
 
@@ -8391,11 +8393,13 @@ bool ASTReader::LoadExternalSpecializationsImpl(
   llvm::SmallVector<serialization::reader::LazySpecializationInfo, 8> Infos =
       It->second.Table.find(HashValue);
 
+  ++NumSpecializationLookups;
   bool NewSpecsFound = false;
   for (auto &Info : Infos) {
     if (GetExistingDecl(Info))
       continue;
     NewSpecsFound = true;
+    ++NumSpecializationsRead;
     GetDecl(Info);
   }
 
@@ -8769,6 +8773,12 @@ void ASTReader::PrintStats() {
                  "  %u / %u identifier table lookups succeeded (%f%%)\n",
                  NumIdentifierLookupHits, NumIdentifierLookups,
                  (double)NumIdentifierLookupHits*100.0/NumIdentifierLookups);
+  if (NumFullSpecializationLoads || NumSpecializationLookups)
+    std::fprintf(stderr,
+                 "  %u specializations read by %u argument lookups and %u "
+                 "full loads\n",
+                 NumSpecializationsRead, NumSpecializationLookups,
+                 NumFullSpecializationLoads);
 
   if (GlobalIndex) {
     std::fprintf(stderr, "\n");
@@ -16,6 +16,7 @@
 #include "clang/StaticAnalyzer/Core/PathSensitive/AnalysisManager.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/CallEvent.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/DynamicType.h"
+#include "clang/StaticAnalyzer/Core/PathSensitive/EntryPointStats.h"
 #include "clang/StaticAnalyzer/Core/PathSensitive/ExprEngine.h"
 #include "llvm/Support/raw_ostream.h"
 #include <optional>
@@ -23,6 +24,14 @@
 using namespace clang;
 using namespace ento;
 
+#define DEBUG_TYPE "ProgramState"
+
+STAT_COUNTER(NumStatesCreated, "The # of distinct program states created");
+STAT_COUNTER(NumStatesUniqued,
+             "The # of transitions that produced an existing program state");
+STAT_COUNTER(NumStatesRecycled,
+             "The # of program states that reused freed storage");
+
 namespace clang { namespace  ento {
 /// Increments the number of times this state is referenced.
 
@@ -414,11 +423,15 @@ ProgramStateRef ProgramStateManager::getPersistentState(ProgramState &State) {
   State.Profile(ID);
   void *InsertPos;
 
-  if (ProgramState *I = StateSet.FindNodeOrInsertPos(ID, InsertPos))
+  if (ProgramState *I = StateSet.FindNodeOrInsertPos(ID, InsertPos)) {
+    NumStatesUniqued++;
     return I;
+  }
 
+  NumStatesCreated++;
   ProgramState *newState = nullptr;
   if (!freeStates.empty()) {
+    NumStatesRecycled++;
     newState = freeStates.back();
     freeStates.pop_back();
   }
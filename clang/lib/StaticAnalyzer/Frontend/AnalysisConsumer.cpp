@@ -473,6 +473,14 @@ void AnalysisConsumer::HandleDeclsCallGraph(const unsigned LocalTUDeclsSize) {
   // inlined functions. The topological order allows the "do not reanalyze
   // previously inlined function" performance heuristic to be triggered more
   // often.
+  //
+  // The walk is inherently sequential: which functions are analyzed as top
+  // level depends on what the earlier ones inlined, so the set of reports is
+  // a function of this order. Each function also gets a fresh ExplodedGraph,
+  // but ExprEngine still lazily builds CFGs and AnalysisDeclContexts, and may
+  // import CTU definitions into the shared ASTContext, none of which is safe
+  // to do from several threads. Splitting a TU across processes is the way to
+  // scale this today.
   SetOfConstDecls Visited;
   SetOfConstDecls VisitedAsTopLevel;
   llvm::ReversePostOrderTraversal<clang::CallGraph*> RPOT(&CG);
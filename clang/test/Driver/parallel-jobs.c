@@ -0,0 +1,18 @@
+// RUN: not %clang -### -parallel-jobs=0 -c %s 2>&1 \
+// RUN:     | FileCheck %s --check-prefix=INVALID
+// RUN: not %clang -### -parallel-jobs=x -c %s 2>&1 \
+// RUN:     | FileCheck %s --check-prefix=INVALID-X
+// INVALID: error: invalid integral value '0' in '-parallel-jobs=0'
+// INVALID-X: error: invalid integral value 'x' in '-parallel-jobs=x'
+
+// The output of jobs that run in parallel is printed in the order of the jobs,
+// and a failing job doesn't stop the others.
+// RUN: echo 'int a = x;' > %t1.c
+// RUN: echo 'int b = 0;' > %t2.c
+// RUN: echo 'int c = z;' > %t3.c
+// RUN: not %clang -fsyntax-only -parallel-jobs=3 %t1.c %t2.c %t3.c 2>&1 \
+// RUN:     | FileCheck %s --check-prefix=ORDER
+// ORDER: 1.c:1:9: error: use of undeclared identifier 'x'
+// ORDER-NOT: error:
+// ORDER: 3.c:1:9: error: use of undeclared identifier 'z'
+// ORDER-NOT: error:
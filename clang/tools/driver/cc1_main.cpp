@@ -214,6 +214,12 @@ static int PrintEnabledExtensions(const TargetOptions& TargetOpts) {
   return 0;
 }
 
+// Each call runs one job and may leave process-wide state behind: -mllvm
+// options are parsed into the global cl::opt registry, and statistics, timers
+// and signal handlers are process-global. The driver only reuses the process
+// for several cc1 jobs (-fintegrated-cc1) because those jobs come from a single
+// command line; running unrelated compiles in one long-lived process would
+// first need that state to become per-invocation.
 int cc1_main(ArrayRef<const char *> Argv, const char *Argv0, void *MainAddr) {
   ensureSufficientStack();
 
@@ -205,14 +205,15 @@ struct GlobalEnv {
     // Choose only those inputs that have new features.
     GetSizedFilesFromDir(Job->CorpusDir, &TempFiles);
     std::sort(TempFiles.begin(), TempFiles.end());
+    std::vector<uint32_t> FileFeatures;
     for (auto &F : TempFiles) {
       auto FeatureFile = F.File;
       FeatureFile.replace(0, Job->CorpusDir.size(), Job->FeaturesDir);
       auto FeatureBytes = FileToVector(FeatureFile, 0, false);
       assert((FeatureBytes.size() % sizeof(uint32_t)) == 0);
-      std::vector<uint32_t> NewFeatures(FeatureBytes.size() / sizeof(uint32_t));
-      memcpy(NewFeatures.data(), FeatureBytes.data(), FeatureBytes.size());
-      for (auto Ft : NewFeatures) {
+      FileFeatures.resize(FeatureBytes.size() / sizeof(uint32_t));
+      memcpy(FileFeatures.data(), FeatureBytes.data(), FeatureBytes.size());
+      for (auto Ft : FileFeatures) {
         if (!Features.count(Ft)) {
           MergeCandidates.push_back(F);
           break;
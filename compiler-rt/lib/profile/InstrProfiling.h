@@ -171,6 +171,13 @@ void __llvm_profile_instrument_target_value(uint64_t TargetValue, void *Data,
  * or if it hasn't been called, the \c LLVM_PROFILE_FILE environment variable,
  * or if that's not set, the last name set to INSTR_PROF_PROFILE_NAME_VAR,
  * or if that's not set,  \c "default.profraw".
+ *
+ * A long-running process can export periodic deltas without stopping by
+ * calling this from one of its own threads, with merging disabled and a
+ * fresh file name each time, followed by \a __llvm_profile_reset_counters().
+ * Each file then holds only the counts since the previous snapshot, and
+ * \c llvm-profdata \c merge sums them. Increments that race with the write or
+ * the reset may be lost, so the deltas are approximate.
  */
 int __llvm_profile_write_file(void);
 
@@ -137,7 +137,9 @@ class Symbolizer final {
   static Symbolizer *GetOrInit();
   static void LateInitialize();
   // Returns a list of symbolized frames for a given address (containing
-  // all inlined functions, if necessary).
+  // all inlined functions, if necessary). Results are not cached: every call
+  // queries the tools again, which for an external llvm-symbolizer is one
+  // pipe round-trip per address, even for frames shared by many stacks.
   SymbolizedStack *SymbolizePC(uptr address);
   bool SymbolizeData(uptr address, DataInfo *info);
   bool SymbolizeFrame(uptr address, FrameInfo *info);
@@ -24,6 +24,16 @@
 
 namespace scudo {
 
+// A fixed pool of TSDs shared by all threads. A thread is bound round-robin to
+// one TSD when it first allocates, and keeps using it while the try-lock
+// succeeds. On contention it probes a few other TSDs and rebinds to the first
+// free one, or else to the one with the lowest precedence (see
+// getTSDAndLockSlow). So the memory held in caches is bounded by the pool
+// size, not by the thread count. The pool starts at
+// min(#CPUs, DefaultTSDCount) entries. It can grow up to TSDsArraySize at run
+// time through Option::MaxTSDsCount (mallopt(M_TSDS_COUNT_MAX)); sizing
+// TSDsArraySize near the core count keeps heavily threaded processes from
+// piling onto a few locks.
 template <class Allocator, u32 TSDsArraySize, u32 DefaultTSDCount>
 struct TSDRegistrySharedT {
   using ThisT = TSDRegistrySharedT<Allocator, TSDsArraySize, DefaultTSDCount>;
@@ -77,6 +77,14 @@ void OnInitialize() {
 }
 #endif
 
+// Trace parts are recycled through a single global queue in LRU order so
+// that total trace memory stays bounded by history_size no matter how many
+// threads come and go: the oldest part, even one still owned by another
+// (possibly finished) trace, is the first to be reused. This is why the
+// queue is guarded by slot_mtx rather than kept per thread. The lock is
+// taken once per part switch, i.e. once per TracePart::kSize events, and
+// TraceSwitchPartImpl already keeps about half of each thread's parts out
+// of the queue.
 static TracePart* TracePartAlloc(ThreadState* thr) {
   TracePart* part = nullptr;
   {
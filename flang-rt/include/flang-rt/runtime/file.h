@@ -60,7 +60,12 @@ public:
   // Truncates the file
   void Truncate(FileOffset, IoErrorHandler &);
 
-  // Asynchronous transfers
+  // Asynchronous transfers.  Nothing calls these yet: a data transfer
+  // statement with ASYNCHRONOUS='YES' only allocates an ID for a later WAIT
+  // and otherwise moves its data synchronously through the unit's frame
+  // buffer like any other statement.  Overlapping a transfer with
+  // computation would need the pending operation to own its bytes, since
+  // the frame is reused as soon as the statement ends.
   int ReadAsynchronously(FileOffset, char *, std::size_t, IoErrorHandler &);
   int WriteAsynchronously(
       FileOffset, const char *, std::size_t, IoErrorHandler &);
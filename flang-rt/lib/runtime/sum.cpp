@@ -35,6 +35,16 @@ public:
     sum_ += *array_.Element<A>(at);
     return true;
   }
+  // Integer addition is associative, so the host compiler is free to
+  // vectorize this loop.
+  template <typename A>
+  RT_API_ATTRS void AccumulateContiguous(const A *p, std::size_t n) {
+    INTERMEDIATE sum{0};
+    for (std::size_t j{0}; j < n; ++j) {
+      sum += p[j];
+    }
+    sum_ += sum;
+  }
 
 private:
   const Descriptor &array_;
@@ -36,6 +36,21 @@ TEST(Reductions, Int4Ops) {
   EXPECT_EQ(eor, 7) << eor;
 }
 
+TEST(Reductions, SumInt4Strided) {
+  // Every other element of [1..8]: a non-contiguous section must not take
+  // the contiguous SUM path.
+  std::vector<std::int32_t> data{1, 2, 3, 4, 5, 6, 7, 8};
+  SubscriptValue extent{4};
+  StaticDescriptor<1> statDesc;
+  Descriptor &section{statDesc.descriptor()};
+  section.Establish(TypeCategory::Integer, 4, data.data(), 1, &extent);
+  section.GetDimension(0).SetByteStride(2 * sizeof(std::int32_t));
+  EXPECT_FALSE(section.IsContiguous());
+  EXPECT_EQ(RTNAME(SumInteger4)(section, __FILE__, __LINE__), 16);
+  section.GetDimension(0).SetByteStride(sizeof(std::int32_t));
+  EXPECT_EQ(RTNAME(SumInteger4)(section, __FILE__, __LINE__), 10);
+}
+
 TEST(Reductions, DimMaskProductInt4) {
   std::vector<int> shape{2, 3};
   auto array{MakeArray<TypeCategory::Integer, 4>(
@@ -34,12 +34,15 @@
 #include "mlir/Pass/PassManager.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "llvm/ADT/TypeSwitch.h"
+#include "llvm/Support/Debug.h"
 
 namespace hlfir {
 #define GEN_PASS_DEF_BUFFERIZEHLFIR
 #include "flang/Optimizer/HLFIR/Passes.h.inc"
 } // namespace hlfir
 
+#define DEBUG_TYPE "bufferize-hlfir"
+
 namespace {
 
 /// Helper to create tuple from a bufferized expr storage and clean up
@@ -732,6 +735,10 @@ struct ElementalOpConversion
                                               adaptor.getTypeparams().end());
     auto [temp, cleanup] = createArrayTemp(loc, builder, elemental.getType(),
                                            shape, extents, typeParams, mold);
+    // Any hlfir.elemental still around at this point could not be fused into
+    // its consumer (see OptimizedBufferization), so it gets a temporary.
+    LLVM_DEBUG(llvm::dbgs() << "array temporary for hlfir.elemental at " << loc
+                            << "\n");
 
     if (optimizeEmptyElementals)
       extents = fir::factory::updateRuntimeExtentsForEmptyArrays(builder, loc,
@@ -31,6 +31,10 @@ using cpp::span;
 
 LIBC_INLINE constexpr bool IsPow2(size_t x) { return x && (x & (x - 1)) == 0; }
 
+// A single best-fit heap over one fixed region, used as the baremetal malloc.
+// It does no locking or per-thread caching, so it is not meant for
+// multithreaded hosted programs; full builds for those targets take malloc
+// and friends from scudo instead (see LLVM_LIBC_INCLUDE_SCUDO).
 class FreeListHeap {
 public:
   constexpr FreeListHeap() : begin(&_end), end(&__llvm_libc_heap_limit) {}
@@ -675,10 +675,12 @@ template <> LIBC_INLINE constexpr int32_t get_lower_bound<double>() {
 // to update it in both libc and libc++.
 // -----------------------------------------------------------------------------
 // Takes a mantissa and base 10 exponent and converts it into its closest
-// floating point type T equivalient. First we try the Eisel-Lemire algorithm,
-// then if that fails then we fall back to a more accurate algorithm for
-// accuracy. The resulting mantissa and exponent are placed in outputMantissa
-// and outputExp2.
+// floating point type T equivalient. Untruncated inputs that fit Clinger's
+// fast path are converted with one correctly rounded multiply or divide. Next
+// we try the Eisel-Lemire algorithm, which handles nearly all remaining
+// inputs with a 128-bit multiplication. Only if that fails do we fall back to
+// the slower but always correct simple decimal conversion. The resulting
+// mantissa and exponent are returned in the FloatConvertReturn.
 template <class T>
 LIBC_INLINE FloatConvertReturn<T> decimal_exp_to_float(
     ExpandedFloat<T> init_num, bool truncated, RoundDirection round,
@@ -223,10 +223,35 @@ LIBC_INLINE size_t strlcpy(char *__restrict dst, const char *__restrict src,
   return len;
 }
 
+// Returns a pointer no further than the first byte of 'src' that is either
+// 'ch' or the null terminator, skipping whole blocks that contain neither.
+template <typename Word>
+LIBC_INLINE const char *skip_to_character_or_null_wide_read(const char *src,
+                                                            char ch) {
+  // Step 1: read 1 byte at a time to align to block size
+  for (; reinterpret_cast<uintptr_t>(src) % sizeof(Word) != 0; ++src) {
+    if (*src == '\0' || *src == ch)
+      return src;
+  }
+  const Word ch_mask = repeat_byte<Word>(static_cast<unsigned char>(ch));
+  // Step 2: read blocks
+  const Word *block_ptr = reinterpret_cast<const Word *>(src);
+  for (; !has_zeroes<Word>(*block_ptr) &&
+         !has_zeroes<Word>((*block_ptr) ^ ch_mask);
+       ++block_ptr)
+    ;
+  return reinterpret_cast<const char *>(block_ptr);
+}
+
 template <bool ReturnNull = true>
 LIBC_INLINE constexpr static char *strchr_implementation(const char *src,
                                                          int c) {
   char ch = static_cast<char>(c);
+#ifdef LIBC_COPT_STRING_UNSAFE_WIDE_READ
+  // Unsigned int is used for the same reason as in strlen.
+  if (!cpp::is_constant_evaluated())
+    src = skip_to_character_or_null_wide_read<unsigned int>(src, ch);
+#endif
   for (; *src && *src != ch; ++src)
     ;
   char *ret = ReturnNull ? nullptr : const_cast<char *>(src);
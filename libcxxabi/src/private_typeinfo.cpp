@@ -264,6 +264,40 @@ const void* dyn_cast_try_downcast(const void* static_ptr,
     return nullptr;
 }
 
+/// A helper function for __dynamic_cast that handles hierarchies built from
+/// single, public, non-virtual inheritance, i.e. chains of
+/// __si_class_type_info.
+///
+/// Every class on such a chain is a unique public base at offset 0 of the
+/// complete object. So if both static_type and dst_type are found by walking
+/// up the chain from dynamic_type, then dynamic_ptr is the casting result.
+/// This function returns nullptr if that cannot be shown; the caller then has
+/// to do the full search.
+const void* dyn_cast_si_chain(const void* static_ptr,
+                              const void* dynamic_ptr,
+                              const __class_type_info* static_type,
+                              const __class_type_info* dst_type,
+                              const __class_type_info* dynamic_type)
+{
+    if (static_ptr != dynamic_ptr)
+        return nullptr;
+
+    bool found_static_type = false;
+    bool found_dst_type = false;
+    for (const __class_type_info* type = dynamic_type;;)
+    {
+        found_static_type |= is_equal(type, static_type, false);
+        found_dst_type |= is_equal(type, dst_type, false);
+        if (found_static_type && found_dst_type)
+            return dynamic_ptr;
+        // Anything but single inheritance, or the root of the hierarchy, ends
+        //   the chain. Don't use dynamic_cast here, it would recurse.
+        if (!is_equal(&typeid(*type), &typeid(__si_class_type_info), false))
+            return nullptr;
+        type = static_cast<const __si_class_type_info*>(type)->__base_type;
+    }
+}
+
 const void* dyn_cast_slow(const void* static_ptr,
                           const void* dynamic_ptr,
                           const __class_type_info* static_type,
@@ -931,13 +965,23 @@ __dynamic_cast(const void *static_ptr, const __class_type_info *static_type,
     }
     else
     {
+        // Single inheritance only needs a walk up the chain of base classes.
+        dst_ptr = dyn_cast_si_chain(static_ptr,
+                                    derived_info.dynamic_ptr,
+                                    static_type,
+                                    dst_type,
+                                    derived_info.dynamic_type);
+
         // Optimize toward downcasting: let's first try to do a downcast before
         //   falling back to the slow path.
-        dst_ptr = dyn_cast_try_downcast(static_ptr,
-                                        derived_info.dynamic_ptr,
-                                        dst_type,
-                                        derived_info.dynamic_type,
-                                        src2dst_offset);
+        if (!dst_ptr)
+        {
+            dst_ptr = dyn_cast_try_downcast(static_ptr,
+                                            derived_info.dynamic_ptr,
+                                            dst_type,
+                                            derived_info.dynamic_type,
+                                            src2dst_offset);
+        }
 
         if (!dst_ptr)
         {
@@ -148,6 +148,40 @@ void test()
 
 }  // t5
 
+namespace t6
+{
+
+// Single inheritance only, including a chain that reaches a base through
+// private inheritance.
+struct A { virtual ~A() {} Pad1 _; };
+struct B : A { Pad2 _; };
+struct C : B { Pad3 _; };
+struct D : C { Pad4 _; };
+struct Unrelated { virtual ~Unrelated() {} Pad5 _; };
+struct P : private A { A* getA() { return this; } Pad6 _; };
+struct Q : P { Pad7 _; };
+
+D d;
+C c;
+Q q;
+
+void test()
+{
+    A* a = &d;
+    assert(dynamic_cast<B*>(a) == static_cast<B*>(&d));
+    assert(dynamic_cast<C*>(a) == static_cast<C*>(&d));
+    assert(dynamic_cast<D*>(a) == &d);
+    assert(dynamic_cast<Unrelated*>(a) == 0);
+    B* b = &c;
+    assert(dynamic_cast<C*>(b) == &c);
+    assert(dynamic_cast<D*>(b) == 0);
+    a = q.getA();
+    assert(dynamic_cast<P*>(a) == 0);
+    assert(dynamic_cast<Q*>(a) == 0);
+}
+
+}  // t6
+
 int main(int, char**)
 {
     t1::test();
@@ -155,6 +189,7 @@ int main(int, char**)
     t3::test();
     t4::test();
     t5::test();
+    t6::test();
 
     return 0;
 }
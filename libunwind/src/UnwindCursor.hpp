@@ -139,6 +139,9 @@ private:
   // These fields are all static to avoid needing an initializer.
   // There is only one instance of this class per process.
   static RWMutex _lock;
+  // Set once the first entry is added. Until then lookups return without
+  // taking _lock, which otherwise every thread that is unwinding contends on.
+  static bool _hasEntries;
 #ifdef __APPLE__
   static void dyldUnloadHook(const struct mach_header *mh, intptr_t slide);
   static bool _registeredForDyldUnloads;
@@ -167,6 +170,9 @@ typename DwarfFDECache<A>::entry DwarfFDECache<A>::_initialBuffer[64];
 template <typename A>
 RWMutex DwarfFDECache<A>::_lock;
 
+template <typename A>
+bool DwarfFDECache<A>::_hasEntries = false;
+
 #ifdef __APPLE__
 template <typename A>
 bool DwarfFDECache<A>::_registeredForDyldUnloads = false;
@@ -175,6 +181,8 @@ bool DwarfFDECache<A>::_registeredForDyldUnloads = false;
 template <typename A>
 typename A::pint_t DwarfFDECache<A>::findFDE(pint_t mh, pint_t pc) {
   pint_t result = 0;
+  if (!__atomic_load_n(&_hasEntries, __ATOMIC_ACQUIRE))
+    return result;
   _LIBUNWIND_LOG_IF_FALSE(_lock.lock_shared());
   for (entry *p = _buffer; p < _bufferUsed; ++p) {
     if ((mh == p->mh) || (mh == kSearchAll)) {
@@ -210,6 +218,7 @@ void DwarfFDECache<A>::add(pint_t mh, pint_t ip_start, pint_t ip_end,
   _bufferUsed->ip_end = ip_end;
   _bufferUsed->fde = fde;
   ++_bufferUsed;
+  __atomic_store_n(&_hasEntries, true, __ATOMIC_RELEASE);
 #ifdef __APPLE__
   if (!_registeredForDyldUnloads) {
     _dyld_register_func_for_remove_image(&dyldUnloadHook);
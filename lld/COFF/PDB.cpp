@@ -1159,7 +1159,10 @@ void PDBLinker::addObjectsToPDB() {
     if (ctx.config.debugGHashes)
       tMerger.mergeTypesWithGHash();
 
-    // Merge dependencies and then regular objects.
+    // Merge dependencies and then regular objects. Unlike ghash loading and
+    // type merging, symbol merging stays serial: every module appends to the
+    // shared PDB string table, global symbol stream and file checksums, and
+    // the order of those appends determines the output.
     {
       llvm::TimeTraceScope timeScope("Merge debug info (dependencies)");
       for (TpiSource *source : tMerger.dependencySources)
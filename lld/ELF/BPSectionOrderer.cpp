@@ -29,6 +29,9 @@ struct BPOrdererELF : lld::BPOrderer<BPOrdererELF> {
   DenseMap<const InputSectionBase *, Defined *> secToSym;
 
   static uint64_t getSize(const Section &sec) { return sec.getSize(); }
+  static ArrayRef<uint8_t> getContent(const Section &sec) {
+    return sec.content();
+  }
   static bool isCodeSection(const Section &sec) {
     return sec.flags & ELF::SHF_EXECINSTR;
   }
@@ -64,8 +67,8 @@ struct BPOrdererELF : lld::BPOrderer<BPOrdererELF> {
 
 DenseMap<const InputSectionBase *, int> elf::runBalancedPartitioning(
     Ctx &ctx, StringRef profilePath, bool forFunctionCompression,
-    bool forDataCompression, bool compressionSortStartupFunctions,
-    bool verbose) {
+    bool forDataCompression, bool compressionSortStartupFunctions, bool verbose,
+    StringRef cachePath) {
   // Collect candidate sections and associated symbols.
   SmallVector<InputSectionBase *> sections;
   DenseMap<CachedHashStringRef, std::set<unsigned>> rootSymbolToSectionIdxs;
@@ -95,5 +98,5 @@ DenseMap<const InputSectionBase *, int> elf::runBalancedPartitioning(
   return orderer.computeOrder(profilePath, forFunctionCompression,
                               forDataCompression,
                               compressionSortStartupFunctions, verbose,
-                              sections, rootSymbolToSectionIdxs);
+                              cachePath, sections, rootSymbolToSectionIdxs);
 }
@@ -27,10 +27,14 @@ class InputSectionBase;
 /// It is important that -ffunction-sections and -fdata-sections compiler flags
 /// are used to ensure functions and data are in their own sections and thus
 /// can be reordered.
+///
+/// If cachePath is not empty, the order is saved to it and reused by later
+/// links with the same profile and options.
 llvm::DenseMap<const InputSectionBase *, int>
 runBalancedPartitioning(Ctx &ctx, llvm::StringRef profilePath,
                         bool forFunctionCompression, bool forDataCompression,
-                        bool compressionSortStartupFunctions, bool verbose);
+                        bool compressionSortStartupFunctions, bool verbose,
+                        llvm::StringRef cachePath);
 
 } // namespace lld::elf
 
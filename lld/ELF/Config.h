@@ -14,6 +14,7 @@
 #include "llvm/ADT/CachedHashString.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/MapVector.h"
+#include "llvm/ADT/STLFunctionalExtras.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/ADT/StringRef.h"
@@ -49,6 +50,7 @@ class Symbol;
 class SymbolTable;
 class BitcodeCompiler;
 class OutputSection;
+class OutputHasher;
 class LinkerScript;
 class TargetInfo;
 struct Ctx;
@@ -248,6 +250,7 @@ struct Config {
   llvm::StringRef sysroot;
   llvm::StringRef thinLTOCacheDir;
   llvm::StringRef thinLTOIndexOnlyArg;
+  llvm::StringRef thinLTOJobGraphFile;
   llvm::StringRef whyExtract;
   llvm::SmallVector<llvm::GlobPattern, 0> whyLive;
   llvm::StringRef cmseInputLib;
@@ -262,6 +265,7 @@ struct Config {
   ReportPolicy zZicfilpFuncSigReport = ReportPolicy::None;
   ReportPolicy zZicfissReport = ReportPolicy::None;
   bool ltoBBAddrMap;
+  bool ltoParallelOpt;
   llvm::StringRef ltoBasicBlockSections;
   std::pair<llvm::StringRef, llvm::StringRef> thinLTOObjectSuffixReplace;
   llvm::StringRef thinLTOPrefixReplaceOld;
@@ -302,6 +306,7 @@ struct Config {
   bool bpFunctionOrderForCompression = false;
   bool bpDataOrderForCompression = false;
   bool bpVerboseSectionOrderer = false;
+  llvm::StringRef bpCachePath;
   bool branchToBranch = false;
   bool checkSections;
   bool checkDynamicRelocs;
@@ -357,10 +362,12 @@ struct Config {
   bool printGcSections;
   bool printIcfSections;
   bool printMemoryUsage;
+  std::optional<uint64_t> icfHotThreshold;
   std::optional<uint64_t> randomizeSectionPadding;
   bool rejectMismatch;
   bool relax;
   bool relaxGP;
+  bool releaseMergeTables;
   bool relocatable;
   bool resolveGroups;
   bool relrGlibc = false;
@@ -525,6 +532,9 @@ struct Config {
   // When using a unified pre-link LTO pipeline, specify the backend LTO mode.
   LtoKind ltoKind = LtoKind::Default;
 
+  // The size of the thread pool, which also sizes per-thread data structures.
+  // Link phases listed in LinkPhase may use fewer threads, see
+  // getPhaseThreadCount.
   unsigned threadCount;
 
   // If an input file equals a key, remap it to the value.
@@ -605,6 +615,11 @@ struct Ctx : CommonLinkerContext {
   // These variables are initialized by Writer and should not be used before
   // Writer is initialized.
   uint8_t *bufferStart = nullptr;
+  // Set while the output sections are written if --build-id hashing is
+  // overlapped with writing.
+  OutputHasher *outputHasher = nullptr;
+  // The LinkPhases whose thread count has been reported, as a bit mask.
+  uint8_t reportedLinkPhases = 0;
   Partition *mainPart = nullptr;
   PhdrEntry *tlsPhdr = nullptr;
   struct OutSections {
@@ -780,6 +795,23 @@ ELFSyncStream Fatal(Ctx &ctx);
 
 uint64_t errCount(Ctx &ctx);
 
+// Link phases that pick their own degree of parallelism from the amount of
+// work they are given, instead of always using every thread in the pool.
+enum class LinkPhase : uint8_t {
+  Parse,
+  ICF,
+  BuildId,
+};
+
+// Return the number of threads `phase` should use to process `work` units of
+// work. The result is in [1, ctx.arg.threadCount]. The first decision for each
+// phase is reported with --verbose and --time-trace.
+unsigned getPhaseThreadCount(Ctx &ctx, LinkPhase phase, uint64_t work);
+
+// Call fn(i) for each i in [begin, end) using at most `concurrency` threads.
+void parallelForN(unsigned concurrency, size_t begin, size_t end,
+                  llvm::function_ref<void(size_t)> fn);
+
 ELFSyncStream InternalErr(Ctx &ctx, const uint8_t *buf);
 
 #define CHECK2(E, S) lld::check2((E), [&] { return toStr(ctx, S); })
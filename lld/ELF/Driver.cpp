@@ -1120,6 +1120,16 @@ template <class ELFT> static void readCallGraphsFromObjectFiles(Ctx &ctx) {
   }
 }
 
+template <class ELFT>
+static void readCallGraphProfile(Ctx &ctx, opt::InputArgList &args) {
+  if (auto *arg = args.getLastArg(OPT_call_graph_ordering_file)) {
+    if (std::optional<MemoryBufferRef> buffer = readFile(ctx, arg->getValue()))
+      readCallGraph(ctx, *buffer);
+  } else {
+    readCallGraphsFromObjectFiles<ELFT>(ctx);
+  }
+}
+
 template <class ELFT>
 static void ltoValidateAllVtablesHaveTypeInfos(Ctx &ctx,
                                                opt::InputArgList &args) {
@@ -1229,6 +1239,16 @@ static void parseBPOrdererOptions(Ctx &ctx, opt::InputArgList &args) {
       args.hasFlag(OPT_bp_compression_sort_startup_functions,
                    OPT_no_bp_compression_sort_startup_functions, false);
   ctx.arg.bpVerboseSectionOrderer = args.hasArg(OPT_verbose_bp_section_orderer);
+  if (auto *arg = args.getLastArg(OPT_bp_cache)) {
+    ctx.arg.bpCachePath = arg->getValue();
+    if (ctx.arg.bpCachePath.empty())
+      ErrAlways(ctx) << arg->getSpelling() << ": expected a file name";
+    else if (!ctx.arg.bpStartupFunctionSort &&
+             !ctx.arg.bpFunctionOrderForCompression &&
+             !ctx.arg.bpDataOrderForCompression)
+      ErrAlways(ctx) << "--bp-cache must be used with "
+                        "--bp-startup-sort=function or --bp-compression-sort";
+  }
 
   ctx.arg.irpgoProfilePath = args.getLastArgValue(OPT_irpgo_profile);
   if (ctx.arg.irpgoProfilePath.empty()) {
@@ -1430,6 +1450,15 @@ static void readConfigs(Ctx &ctx, opt::InputArgList &args) {
   ctx.arg.gnuUnique = args.hasFlag(OPT_gnu_unique, OPT_no_gnu_unique, true);
   ctx.arg.gdbIndex = args.hasFlag(OPT_gdb_index, OPT_no_gdb_index, false);
   ctx.arg.icf = getICF(args);
+  if (auto *arg = args.getLastArg(OPT_icf_hot_threshold)) {
+    uint64_t threshold;
+    if (!to_integer(arg->getValue(), threshold))
+      ErrAlways(ctx) << arg->getSpelling()
+                     << ": expected a non-negative integer, but got '"
+                     << arg->getValue() << "'";
+    else
+      ctx.arg.icfHotThreshold = threshold;
+  }
   ctx.arg.ignoreDataAddressEquality =
       args.hasArg(OPT_ignore_data_address_equality);
   ctx.arg.ignoreFunctionAddressEquality =
@@ -1466,6 +1495,8 @@ static void readConfigs(Ctx &ctx, opt::InputArgList &args) {
                    OPT_no_lto_basic_block_address_map, false);
   ctx.arg.ltoBasicBlockSections =
       args.getLastArgValue(OPT_lto_basic_block_sections);
+  ctx.arg.ltoParallelOpt =
+      args.hasFlag(OPT_lto_parallel_opt, OPT_no_lto_parallel_opt, false);
   ctx.arg.ltoUniqueBasicBlockSectionNames =
       args.hasFlag(OPT_lto_unique_basic_block_section_names,
                    OPT_no_lto_unique_basic_block_section_names, false);
@@ -1513,6 +1544,7 @@ static void readConfigs(Ctx &ctx, opt::InputArgList &args) {
   ctx.arg.rejectMismatch = !args.hasArg(OPT_no_warn_mismatch);
   ctx.arg.relax = args.hasFlag(OPT_relax, OPT_no_relax, true);
   ctx.arg.relaxGP = args.hasFlag(OPT_relax_gp, OPT_no_relax_gp, false);
+  ctx.arg.releaseMergeTables = args.hasArg(OPT_release_merge_tables);
   ctx.arg.rpath = getRpath(args);
   ctx.arg.relocatable = args.hasArg(OPT_relocatable);
   ctx.arg.resolveGroups =
@@ -1560,6 +1592,11 @@ static void readConfigs(Ctx &ctx, opt::InputArgList &args) {
   ctx.arg.thinLTOIndexOnly = args.hasArg(OPT_thinlto_index_only) ||
                              args.hasArg(OPT_thinlto_index_only_eq);
   ctx.arg.thinLTOIndexOnlyArg = args.getLastArgValue(OPT_thinlto_index_only_eq);
+  if (auto *arg = args.getLastArg(OPT_thinlto_job_graph_eq)) {
+    ctx.arg.thinLTOJobGraphFile = arg->getValue();
+    if (ctx.arg.thinLTOJobGraphFile.empty())
+      ErrAlways(ctx) << arg->getSpelling() << ": expected a file name";
+  }
   ctx.arg.thinLTOObjectSuffixReplace =
       getOldNewOptions(ctx, args, OPT_thinlto_object_suffix_replace_eq);
   std::tie(ctx.arg.thinLTOPrefixReplaceOld, ctx.arg.thinLTOPrefixReplaceNew,
@@ -1823,7 +1860,8 @@ static void readConfigs(Ctx &ctx, opt::InputArgList &args) {
   // --threads= takes a positive integer and provides the default value for
   // --thinlto-jobs=. If unspecified, cap the number of threads since
   // overhead outweighs optimization for used parallel algorithms for the
-  // non-LTO parts.
+  // non-LTO parts. Some phases use even fewer threads when they have little
+  // work (see getPhaseThreadCount).
   if (auto *arg = args.getLastArg(OPT_threads)) {
     StringRef v(arg->getValue());
     unsigned threads = 0;
@@ -1843,6 +1881,9 @@ static void readConfigs(Ctx &ctx, opt::InputArgList &args) {
 
   if (ctx.arg.ltoPartitions == 0)
     ErrAlways(ctx) << "--lto-partitions: number of threads must be > 0";
+  else if (ctx.arg.ltoParallelOpt && ctx.arg.ltoPartitions == 1)
+    Warn(ctx) << "--lto-parallel-opt has no effect without --lto-partitions= "
+                 "greater than 1";
   if (!get_threadpool_strategy(ctx.arg.thinLTOJobs))
     ErrAlways(ctx) << "--thinlto-jobs: invalid job count: "
                    << ctx.arg.thinLTOJobs;
@@ -3204,10 +3245,13 @@ template <class ELFT> void LinkerDriver::link(opt::InputArgList &args) {
 
   // No more lazy bitcode can be extracted at this point. Do post parse work
   // like checking duplicate symbols.
-  parallelForEach(ctx.objectFiles, [](ELFFileBase *file) {
-    initSectionsAndLocalSyms(file, /*ignoreComdats=*/false);
+  unsigned parseThreads =
+      getPhaseThreadCount(ctx, LinkPhase::Parse, ctx.objectFiles.size());
+  parallelForN(parseThreads, 0, ctx.objectFiles.size(), [&](size_t i) {
+    initSectionsAndLocalSyms(ctx.objectFiles[i], /*ignoreComdats=*/false);
   });
-  parallelForEach(ctx.objectFiles, postParseObjectFile);
+  parallelForN(parseThreads, 0, ctx.objectFiles.size(),
+               [&](size_t i) { postParseObjectFile(ctx.objectFiles[i]); });
   parallelForEach(ctx.bitcodeFiles,
                   [](BitcodeFile *file) { file->postParse(); });
   for (auto &it : ctx.nonPrevailingSyms) {
@@ -3472,20 +3516,22 @@ template <class ELFT> void LinkerDriver::link(opt::InputArgList &args) {
 
   // Two input sections with different output sections should not be folded.
   // ICF runs after processSectionCommands() so that we know the output sections.
+  // --icf-hot-threshold= needs the call graph to tell hot sections apart, so
+  // read it before ICF, which redirects its edges to the sections it keeps.
+  bool icfReadsCallGraph =
+      ctx.arg.icf != ICFLevel::None && ctx.arg.icfHotThreshold;
   if (ctx.arg.icf != ICFLevel::None) {
     findKeepUniqueSections<ELFT>(ctx, args);
+    if (icfReadsCallGraph)
+      readCallGraphProfile<ELFT>(ctx, args);
     doIcf<ELFT>(ctx);
   }
 
   // Read the callgraph now that we know what was gced or icfed
-  if (ctx.arg.callGraphProfileSort != CGProfileSortKind::None) {
-    if (auto *arg = args.getLastArg(OPT_call_graph_ordering_file)) {
-      if (std::optional<MemoryBufferRef> buffer =
-              readFile(ctx, arg->getValue()))
-        readCallGraph(ctx, *buffer);
-    } else
-      readCallGraphsFromObjectFiles<ELFT>(ctx);
-  }
+  if (ctx.arg.callGraphProfileSort == CGProfileSortKind::None)
+    ctx.arg.callGraphProfile.clear();
+  else if (!icfReadsCallGraph)
+    readCallGraphProfile<ELFT>(ctx, args);
 
   // Write the result to the file.
   writeResult<ELFT>(ctx);
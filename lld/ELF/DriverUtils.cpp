@@ -19,10 +19,13 @@
 #include "llvm/Option/Option.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/TimeProfiler.h"
 #include "llvm/TargetParser/Host.h"
 #include "llvm/TargetParser/Triple.h"
+#include <atomic>
 #include <optional>
 
 using namespace llvm;
@@ -267,3 +270,67 @@ std::optional<std::string> elf::searchScript(Ctx &ctx, StringRef name) {
     return name.str();
   return findFromSearchPaths(ctx, name);
 }
+
+namespace {
+// An entry of the calibration table used for phase-aware thread scaling. A
+// phase gets one thread per `workPerThread` units of work, up to the size of
+// the thread pool, so small links do not pay for waking up every thread.
+struct PhaseScaling {
+  const char *name;
+  const char *unit;
+  uint64_t workPerThread;
+};
+} // namespace
+
+// Indexed by LinkPhase.
+static constexpr PhaseScaling phaseScaling[] = {
+    {"Parse input files", "files", 16},
+    {"ICF", "sections", 4096},
+    {"Build ID", "bytes", 8 << 20},
+};
+static_assert(std::size(phaseScaling) == size_t(LinkPhase::BuildId) + 1,
+              "phaseScaling must have an entry for each LinkPhase");
+
+unsigned elf::getPhaseThreadCount(Ctx &ctx, LinkPhase phase, uint64_t work) {
+  const PhaseScaling &e = phaseScaling[static_cast<size_t>(phase)];
+  uint64_t n = std::max<uint64_t>(1, divideCeil(work, e.workPerThread));
+  n = std::min<uint64_t>(n, ctx.arg.threadCount);
+
+  // Report the decision so that --time-trace and --verbose show how each phase
+  // was scaled. Some phases ask more than once, so only report the first time.
+  uint8_t bit = 1 << static_cast<unsigned>(phase);
+  if (ctx.reportedLinkPhases & bit)
+    return n;
+  ctx.reportedLinkPhases |= bit;
+  llvm::TimeTraceScope timeScope("Thread scaling", [&] {
+    return (Twine(e.name) + ": " + Twine(work) + " " + e.unit + ", " +
+            Twine(n) + " threads")
+        .str();
+  });
+  Log(ctx) << e.name << ": " << work << " " << e.unit << ", using " << n
+           << " of " << ctx.arg.threadCount << " threads";
+  return n;
+}
+
+void elf::parallelForN(unsigned concurrency, size_t begin, size_t end,
+                       llvm::function_ref<void(size_t)> fn) {
+  if (begin == end)
+    return;
+
+  // Start `concurrency` tasks, each of which claims the next batch of indices
+  // until all are taken. This balances the load while capping the number of
+  // threads. The tasks run on pool threads even if `concurrency` is 1, so fn
+  // may use parallel::getThreadIndex().
+  size_t numTasks = std::clamp<size_t>(concurrency, 1, end - begin);
+  size_t batch = std::max<size_t>(1, (end - begin) / (numTasks * 32));
+  std::atomic<size_t> next{begin};
+  parallelFor(0, numTasks, [&](size_t) {
+    for (;;) {
+      size_t i = next.fetch_add(batch, std::memory_order_relaxed);
+      if (i >= end)
+        return;
+      for (size_t e = std::min(i + batch, end); i != e; ++i)
+        fn(i);
+    }
+  });
+}
@@ -123,6 +123,9 @@ private:
   Ctx &ctx;
   SmallVector<InputSection *, 0> sections;
 
+  // The number of threads used by the parallel loops.
+  unsigned numThreads = 1;
+
   // We repeat the main loop while `Repeat` is true.
   std::atomic<bool> repeat;
 
@@ -414,7 +417,7 @@ void ICF<ELFT>::parallelForEachClass(
     llvm::function_ref<void(size_t, size_t)> fn) {
   // If threading is disabled or the number of sections are
   // too small to use threading, call Fn sequentially.
-  if (parallel::strategy.ThreadsRequested == 1 || sections.size() < 1024) {
+  if (numThreads == 1 || sections.size() < 1024) {
     forEachClassRange(0, sections.size(), fn);
     ++cnt;
     return;
@@ -433,11 +436,11 @@ void ICF<ELFT>::parallelForEachClass(
   boundaries[0] = 0;
   boundaries[numShards] = sections.size();
 
-  parallelFor(1, numShards, [&](size_t i) {
+  parallelForN(numThreads, 1, numShards, [&](size_t i) {
     boundaries[i] = findBoundary((i - 1) * step, sections.size());
   });
 
-  parallelFor(1, numShards + 1, [&](size_t i) {
+  parallelForN(numThreads, 1, numShards + 1, [&](size_t i) {
     if (boundaries[i - 1] < boundaries[i])
       forEachClassRange(boundaries[i - 1], boundaries[i], fn);
   });
@@ -475,22 +478,44 @@ template <class ELFT> void ICF<ELFT>::run() {
     part.ehFrame->iterateFDEWithLSDA<ELFT>(
         [&](InputSection &s) { s.eqClass[0] = s.eqClass[1] = ++uniqueId; });
 
+  // With --icf-hot-threshold=, sections that carry more call graph profile
+  // weight than the threshold are not folded, so that hot functions keep
+  // their own i-cache lines and branch predictor entries. A section's weight
+  // is the sum of the weights of the edges from and to it.
+  DenseMap<const InputSectionBase *, uint64_t> profileWeights;
+  if (ctx.arg.icfHotThreshold) {
+    for (const auto &[edge, weight] : ctx.arg.callGraphProfile) {
+      profileWeights[edge.first] += weight;
+      if (edge.second != edge.first)
+        profileWeights[edge.second] += weight;
+    }
+  }
+  SmallVector<std::pair<InputSection *, uint64_t>, 0> hotSections;
+
   // Collect sections to merge.
   for (InputSectionBase *sec : ctx.inputSections) {
     auto *s = dyn_cast<InputSection>(sec);
     if (s && s->eqClass[0] == 0) {
-      if (isEligible(s))
-        sections.push_back(s);
-      else
-        // Ineligible sections are assigned unique IDs, i.e. each section
-        // belongs to an equivalence class of its own.
-        s->eqClass[0] = s->eqClass[1] = ++uniqueId;
+      if (isEligible(s)) {
+        uint64_t weight = profileWeights.lookup(s);
+        if (!ctx.arg.icfHotThreshold || weight <= *ctx.arg.icfHotThreshold) {
+          sections.push_back(s);
+          continue;
+        }
+        hotSections.emplace_back(s, weight);
+      }
+      // Ineligible sections are assigned unique IDs, i.e. each section
+      // belongs to an equivalence class of its own.
+      s->eqClass[0] = s->eqClass[1] = ++uniqueId;
     }
   }
 
+  numThreads = getPhaseThreadCount(ctx, LinkPhase::ICF, sections.size());
+
   // Initially, we use hash values to partition sections.
-  parallelForEach(sections, [&](InputSection *s) {
+  parallelForN(numThreads, 0, sections.size(), [&](size_t i) {
     // Set MSB to 1 to avoid collisions with unique IDs.
+    InputSection *s = sections[i];
     s->eqClass[0] = xxh3_64bits(s->content()) | (1U << 31);
   });
 
@@ -498,7 +523,8 @@ template <class ELFT> void ICF<ELFT>::run() {
   // reduce the average sizes of equivalence classes, i.e. segregate() which has
   // a large time complexity will have less work to do.
   for (unsigned cnt = 0; cnt != 2; ++cnt) {
-    parallelForEach(sections, [&](InputSection *s) {
+    parallelForN(numThreads, 0, sections.size(), [&](size_t i) {
+      InputSection *s = sections[i];
       const RelsOrRelas<ELFT> rels = s->template relsOrRelas<ELFT>();
       if (rels.areRelocsCrel())
         combineRelocHashes(cnt, s, rels.crels);
@@ -537,12 +563,16 @@ template <class ELFT> void ICF<ELFT>::run() {
     return {ctx, ctx.arg.printIcfSections ? DiagLevel::Msg : DiagLevel::None};
   };
   // Merge sections by the equivalence class.
+  size_t numFolded = 0;
+  uint64_t foldedSize = 0;
   forEachClassRange(0, sections.size(), [&](size_t begin, size_t end) {
     if (end - begin == 1)
       return;
     print() << "selected section " << sections[begin];
     for (size_t i = begin + 1; i < end; ++i) {
       print() << "  removing identical section " << sections[i];
+      ++numFolded;
+      foldedSize += sections[i]->getSize();
       sections[begin]->replace(sections[i]);
 
       // At this point we know sections merged are fully identical and hence
@@ -553,6 +583,20 @@ template <class ELFT> void ICF<ELFT>::run() {
     }
   });
 
+  if (ctx.arg.icfHotThreshold) {
+    uint64_t hotSize = 0;
+    for (auto [s, weight] : hotSections) {
+      print() << "not folding hot section " << s << " (profile weight "
+              << weight << ")";
+      hotSize += s->getSize();
+    }
+    print() << "ICF folded " << numFolded << " sections (" << foldedSize
+            << " bytes) and kept " << hotSections.size()
+            << " hot sections (" << hotSize << " bytes) unfolded";
+  }
+  Log(ctx) << "ICF folded " << numFolded << " sections (" << foldedSize
+           << " bytes)";
+
   // Change Defined symbol's section field to the canonical one.
   auto fold = [](Symbol *sym) {
     if (auto *d = dyn_cast<Defined>(sym))
@@ -569,6 +613,22 @@ template <class ELFT> void ICF<ELFT>::run() {
       fold(sym);
   });
 
+  // The call graph profile is read before ICF for --icf-hot-threshold=.
+  // Redirect its edges to the canonical sections.
+  if (!ctx.arg.callGraphProfile.empty()) {
+    auto getRepl = [](const InputSectionBase *s) -> const InputSectionBase * {
+      if (auto *isec = dyn_cast<InputSection>(s))
+        return isec->repl;
+      return s;
+    };
+    MapVector<std::pair<const InputSectionBase *, const InputSectionBase *>,
+              uint64_t>
+        profile;
+    for (const auto &[edge, weight] : ctx.arg.callGraphProfile)
+      profile[{getRepl(edge.first), getRepl(edge.second)}] += weight;
+    ctx.arg.callGraphProfile = std::move(profile);
+  }
+
   // InputSectionDescription::sections is populated by processSectionCommands().
   // ICF may fold some input sections assigned to output sections. Remove them.
   for (SectionCommand *cmd : ctx.script->sectionCommands)
@@ -1774,11 +1774,21 @@ BitcodeFile::BitcodeFile(Ctx &ctx, MemoryBufferRef mb, StringRef archiveName,
                        ? ss.save(path)
                        : ss.save(archiveName + "(" + path::filename(path) +
                                  " at " + utostr(offsetInArchive) + ")");
-  MemoryBufferRef mbref(mb.getBuffer(), name);
-
-  obj = CHECK2(lto::InputFile::create(mbref), this);
+  ltoBuffer = MemoryBufferRef(mb.getBuffer(), name);
+
+  // Most lazy members are never extracted, so for them only read the irsymtab
+  // and defer building the lto::InputFile until parse().
+  StringRef triple;
+  if (lazy) {
+    lazySymtab = std::make_unique<object::IRSymtabFile>(
+        CHECK2(object::readIRSymtab(ltoBuffer), this));
+    triple = lazySymtab->TheReader.getTargetTriple();
+  } else {
+    obj = CHECK2(lto::InputFile::create(ltoBuffer), this);
+    triple = obj->getTargetTriple();
+  }
 
-  Triple t(obj->getTargetTriple());
+  Triple t(triple);
   ekind = getBitcodeELFKind(t);
   emachine = getBitcodeMachineKind(ctx, mb.getBufferIdentifier(), t);
   osabi = getOsAbi(t);
@@ -1837,6 +1847,9 @@ static void createBitcodeSymbol(Ctx &ctx, Symbol *&sym,
 }
 
 void BitcodeFile::parse() {
+  if (!obj)
+    obj = CHECK2(lto::InputFile::create(ltoBuffer), this);
+
   for (std::pair<StringRef, Comdat::SelectionKind> s : obj->getComdatTable()) {
     keptComdats.push_back(
         s.second == Comdat::NoDeduplicate ||
@@ -1862,21 +1875,16 @@ void BitcodeFile::parse() {
 }
 
 void BitcodeFile::parseLazy() {
-  numSymbols = obj->symbols().size();
-  symbols = std::make_unique<Symbol *[]>(numSymbols);
-  for (auto [i, irSym] : llvm::enumerate(obj->symbols())) {
-    // Symbols can be duplicated in bitcode files because of '#include' and
-    // linkonce_odr. Use uniqueSaver to save symbol names for de-duplication.
-    // Update objSym.Name to reference (via StringRef) the string saver's copy;
-    // this way LTO can reference the same string saver's copy rather than
-    // keeping copies of its own.
-    irSym.Name = ctx.uniqueSaver.save(irSym.getName());
-    if (!irSym.isUndefined()) {
-      auto *sym = ctx.symtab->insert(irSym.getName());
-      sym->resolve(ctx, LazySymbol{*this});
-      symbols[i] = sym;
-    }
+  // Only insert the defined names. symbols[] is filled in by parse() if this
+  // member is extracted, at which point obj is created.
+  for (const irsymtab::Reader::SymbolRef &irSym :
+       lazySymtab->TheReader.symbols()) {
+    if (irSym.isUndefined())
+      continue;
+    auto *sym = ctx.symtab->insert(ctx.uniqueSaver.save(irSym.getName()));
+    sym->resolve(ctx, LazySymbol{*this});
   }
+  lazySymtab.reset();
 }
 
 void BitcodeFile::postParse() {
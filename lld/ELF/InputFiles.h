@@ -17,6 +17,7 @@
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/BinaryFormat/Magic.h"
 #include "llvm/Object/ELF.h"
+#include "llvm/Object/IRObjectFile.h"
 #include "llvm/Support/MemoryBufferRef.h"
 #include "llvm/Support/Threading.h"
 
@@ -329,8 +330,17 @@ public:
   void parse();
   void parseLazy();
   void postParse();
+  // Created in the constructor for eagerly loaded files and in parse() for
+  // lazy members that get extracted.
   std::unique_ptr<llvm::lto::InputFile> obj;
   std::vector<bool> keptComdats;
+  // The uniquely named buffer handed to LTO.
+  MemoryBufferRef ltoBuffer;
+
+private:
+  // For lazy files, the irsymtab read by the constructor. Released after
+  // parseLazy().
+  std::unique_ptr<llvm::object::IRSymtabFile> lazySymtab;
 };
 
 // .so file.
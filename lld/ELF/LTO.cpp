@@ -100,6 +100,7 @@ static lto::Config createConfig(Ctx &ctx) {
   c.DisableVerify = ctx.arg.disableVerify;
   c.DiagHandler = diagnosticHandler;
   c.OptLevel = ctx.arg.ltoo;
+  c.ParallelRegularLTOOpt = ctx.arg.ltoParallelOpt;
   c.CPU = getCPUStr();
   c.MAttrs = getMAttrs();
   c.CGOptLevel = ctx.arg.ltoCgo;
@@ -120,6 +121,7 @@ static lto::Config createConfig(Ctx &ctx) {
 
   // Set up output file to emit statistics.
   c.StatsFile = std::string(ctx.arg.optStatsFilename);
+  c.ThinLTOJobGraphFile = std::string(ctx.arg.thinLTOJobGraphFile);
 
   c.SampleProfile = std::string(ctx.arg.ltoSampleProfile);
   for (StringRef pluginFn : ctx.arg.passPlugins)
@@ -287,8 +289,8 @@ static void thinLTOCreateEmptyIndexFiles(Ctx &ctx) {
       continue;
     if (linkedBitCodeFiles.contains(f->getName()))
       continue;
-    std::string path =
-        replaceThinLTOSuffix(ctx, getThinLTOOutputFile(ctx, f->obj->getName()));
+    std::string path = replaceThinLTOSuffix(
+        ctx, getThinLTOOutputFile(ctx, f->ltoBuffer.getBufferIdentifier()));
     std::unique_ptr<raw_fd_ostream> os = openFile(path + ".thinlto.bc");
     if (!os)
       continue;
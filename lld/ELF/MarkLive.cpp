@@ -17,6 +17,10 @@
 // bits. Writer will then ignore sections whose Live bits are off, so that
 // such sections are not included into output.
 //
+// Unless --why-live is given, the worklist is drained by all threads. Each
+// section is claimed by exactly one thread through an atomic update of its
+// partition, so the result is the same as that of a serial traversal.
+//
 //===----------------------------------------------------------------------===//
 
 #include "MarkLive.h"
@@ -30,7 +34,9 @@
 #include "lld/Common/Strings.h"
 #include "llvm/ADT/DenseMapInfoVariant.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/TimeProfiler.h"
+#include <atomic>
 #include <variant>
 #include <vector>
 
@@ -55,7 +61,10 @@ struct LiveReason {
 
 template <class ELFT, bool TrackWhyLive> class MarkLive {
 public:
-  MarkLive(Ctx &ctx, unsigned partition) : ctx(ctx), partition(partition) {}
+  MarkLive(Ctx &ctx, unsigned partition)
+      : ctx(ctx), partition(partition),
+        isParallel(!TrackWhyLive &&
+                   llvm::parallel::strategy.ThreadsRequested != 1) {}
 
   void run();
   void moveToMain();
@@ -64,8 +73,12 @@ public:
 private:
   void enqueue(InputSectionBase *sec, uint64_t offset, Symbol *sym,
                LiveReason reason);
+  bool claim(InputSectionBase *sec);
   void markSymbol(Symbol *sym, StringRef reason);
   void mark();
+  void markParallel();
+  void runTask(ArrayRef<InputSection *> seeds);
+  void visit(InputSectionBase &sec);
 
   template <class RelTy>
   void resolveReloc(InputSectionBase &sec, RelTy &rel, bool fromFDE);
@@ -76,10 +89,26 @@ private:
   Ctx &ctx;
   // The index of the partition that we are currently processing.
   unsigned partition;
+  // True if mark() may drain the worklist with multiple threads.
+  bool isParallel;
 
   // A list of sections to visit.
   SmallVector<InputSection *, 0> queue;
 
+  // Per-thread state of the parallel mark phase. Symbol::used,
+  // SharedFile::isNeeded and SectionPiece::live are not safe to set
+  // concurrently, so they are recorded here and applied after all threads are
+  // done.
+  struct Worker {
+    SmallVector<InputSection *, 0> queue;
+    SmallVector<Symbol *, 0> usedSyms;
+    SmallVector<SharedFile *, 0> neededFiles;
+    SmallVector<SectionPiece *, 0> livePieces;
+  };
+  // Non-null only while markParallel() is running.
+  std::unique_ptr<Worker[]> workers;
+  llvm::parallel::TaskGroup *tg = nullptr;
+
   // There are normally few input sections whose names are valid C
   // identifiers, so we just store a SmallVector instead of a multimap.
   DenseMap<StringRef, SmallVector<InputSectionBase *, 0>> cNamedSections;
@@ -118,7 +147,13 @@ void MarkLive<ELFT, TrackWhyLive>::resolveReloc(InputSectionBase &sec,
                                                 RelTy &rel, bool fromFDE) {
   // If a symbol is referenced in a live section, it is used.
   Symbol &sym = sec.file->getRelocTargetSym(rel);
-  sym.used = true;
+  if (!workers)
+    sym.used = true;
+  else if (!sym.used && (!isa<Defined>(sym) || ctx.arg.copyRelocs))
+    // The field is only consulted for non-Defined symbols, or for Defined
+    // symbols with -r or --emit-relocs (see includeInSymtab and
+    // shouldKeepInSymtab), so skip the rest to keep the buffers small.
+    workers[llvm::parallel::getThreadIndex()].usedSyms.push_back(&sym);
 
   LiveReason reason;
   if (TrackWhyLive)
@@ -161,7 +196,11 @@ void MarkLive<ELFT, TrackWhyLive>::resolveReloc(InputSectionBase &sec,
 
   if (auto *ss = dyn_cast<SharedSymbol>(&sym)) {
     if (!ss->isWeak()) {
-      cast<SharedFile>(ss->file)->isNeeded = true;
+      auto *file = cast<SharedFile>(ss->file);
+      if (!workers)
+        file->isNeeded = true;
+      else if (!file->isNeeded)
+        workers[llvm::parallel::getThreadIndex()].neededFiles.push_back(file);
       if (TrackWhyLive)
         whyLive.try_emplace(&sym, reason);
     }
@@ -225,6 +264,31 @@ static bool isReserved(InputSectionBase *sec) {
   }
 }
 
+// Set Sec->Partition to the meet (i.e. the "minimum") of Partition and
+// Sec->Partition in the following lattice: 1 < other < 0. Returns true if
+// Sec->Partition changed, in which case the caller is responsible for visiting
+// the section.
+template <class ELFT, bool TrackWhyLive>
+bool MarkLive<ELFT, TrackWhyLive>::claim(InputSectionBase *sec) {
+  if (!workers) {
+    if (sec->partition == 1 || sec->partition == partition)
+      return false;
+    sec->partition = sec->partition ? 1 : partition;
+    return true;
+  }
+
+  // Several threads may reach the same section at once. Only the one whose
+  // update succeeds gets to visit it.
+  auto *p = reinterpret_cast<std::atomic<uint8_t> *>(&sec->partition);
+  uint8_t old = p->load(std::memory_order_relaxed);
+  do {
+    if (old == 1 || old == partition)
+      return false;
+  } while (!p->compare_exchange_weak(old, old ? 1 : partition,
+                                     std::memory_order_relaxed));
+  return true;
+}
+
 template <class ELFT, bool TrackWhyLive>
 void MarkLive<ELFT, TrackWhyLive>::enqueue(InputSectionBase *sec,
                                            uint64_t offset, Symbol *sym,
@@ -232,15 +296,17 @@ void MarkLive<ELFT, TrackWhyLive>::enqueue(InputSectionBase *sec,
   // Usually, a whole section is marked as live or dead, but in mergeable
   // (splittable) sections, each piece of data has independent liveness bit.
   // So we explicitly tell it which offset is in use.
-  if (auto *ms = dyn_cast<MergeInputSection>(sec))
-    ms->getSectionPiece(offset).live = true;
+  if (auto *ms = dyn_cast<MergeInputSection>(sec)) {
+    SectionPiece &piece = ms->getSectionPiece(offset);
+    if (!workers)
+      piece.live = true;
+    else if (!piece.live)
+      workers[llvm::parallel::getThreadIndex()].livePieces.push_back(&piece);
+  }
 
-  // Set Sec->Partition to the meet (i.e. the "minimum") of Partition and
-  // Sec->Partition in the following lattice: 1 < other < 0. If Sec->Partition
-  // doesn't change, we don't need to do anything.
-  if (sec->partition == 1 || sec->partition == partition)
+  // If Sec->Partition doesn't change, we don't need to do anything.
+  if (!claim(sec))
     return;
-  sec->partition = sec->partition ? 1 : partition;
 
   if (TrackWhyLive) {
     if (sym) {
@@ -255,8 +321,12 @@ void MarkLive<ELFT, TrackWhyLive>::enqueue(InputSectionBase *sec,
   }
 
   // Add input section to the queue.
-  if (InputSection *s = dyn_cast<InputSection>(sec))
-    queue.push_back(s);
+  if (InputSection *s = dyn_cast<InputSection>(sec)) {
+    if (workers)
+      workers[llvm::parallel::getThreadIndex()].queue.push_back(s);
+    else
+      queue.push_back(s);
+  }
 }
 
 // Print the stack of reasons that the given symbol is live.
@@ -442,29 +512,89 @@ void MarkLive<ELFT, TrackWhyLive>::run() {
   }
 }
 
+template <class ELFT, bool TrackWhyLive>
+void MarkLive<ELFT, TrackWhyLive>::visit(InputSectionBase &sec) {
+  const RelsOrRelas<ELFT> rels = sec.template relsOrRelas<ELFT>();
+  for (const typename ELFT::Rel &rel : rels.rels)
+    resolveReloc(sec, rel, false);
+  for (const typename ELFT::Rela &rel : rels.relas)
+    resolveReloc(sec, rel, false);
+  for (const typename ELFT::Crel &rel : rels.crels)
+    resolveReloc(sec, rel, false);
+
+  for (InputSectionBase *isec : sec.dependentSections)
+    enqueue(isec, /*offset=*/0, /*sym=*/nullptr,
+            {&sec, "depended on by section"});
+
+  // Mark the next group member.
+  if (sec.nextInSectionGroup)
+    enqueue(sec.nextInSectionGroup, /*offset=*/0, /*sym=*/nullptr,
+            {&sec, "in section group with"});
+}
+
 template <class ELFT, bool TrackWhyLive>
 void MarkLive<ELFT, TrackWhyLive>::mark() {
+  if (isParallel) {
+    markParallel();
+    return;
+  }
+
   // Mark all reachable sections.
-  while (!queue.empty()) {
-    InputSectionBase &sec = *queue.pop_back_val();
-
-    const RelsOrRelas<ELFT> rels = sec.template relsOrRelas<ELFT>();
-    for (const typename ELFT::Rel &rel : rels.rels)
-      resolveReloc(sec, rel, false);
-    for (const typename ELFT::Rela &rel : rels.relas)
-      resolveReloc(sec, rel, false);
-    for (const typename ELFT::Crel &rel : rels.crels)
-      resolveReloc(sec, rel, false);
-
-    for (InputSectionBase *isec : sec.dependentSections)
-      enqueue(isec, /*offset=*/0, /*sym=*/nullptr,
-              {&sec, "depended on by section"});
-
-    // Mark the next group member.
-    if (sec.nextInSectionGroup)
-      enqueue(sec.nextInSectionGroup, /*offset=*/0, /*sym=*/nullptr,
-              {&sec, "in section group with"});
+  while (!queue.empty())
+    visit(*queue.pop_back_val());
+}
+
+// The number of sections handed to another task at once. A thread whose local
+// worklist grows to twice this size gives a chunk away so that idle threads
+// can pick it up.
+static constexpr size_t markChunkSize = 128;
+
+template <class ELFT, bool TrackWhyLive>
+void MarkLive<ELFT, TrackWhyLive>::runTask(ArrayRef<InputSection *> seeds) {
+  // Tasks do not nest, so the local worklist is empty when a task starts.
+  SmallVector<InputSection *, 0> &q =
+      workers[llvm::parallel::getThreadIndex()].queue;
+  q.append(seeds.begin(), seeds.end());
+  while (!q.empty()) {
+    if (q.size() >= 2 * markChunkSize) {
+      SmallVector<InputSection *, 0> chunk(q.end() - markChunkSize, q.end());
+      q.resize(q.size() - markChunkSize);
+      tg->spawn([this, chunk = std::move(chunk)] { runTask(chunk); });
+    }
+    visit(*q.pop_back_val());
+  }
+}
+
+template <class ELFT, bool TrackWhyLive>
+void MarkLive<ELFT, TrackWhyLive>::markParallel() {
+  if (queue.empty())
+    return;
+
+  workers = std::make_unique<Worker[]>(ctx.arg.threadCount);
+  {
+    llvm::parallel::TaskGroup group;
+    tg = &group;
+    ArrayRef<InputSection *> roots = queue;
+    for (size_t i = 0, e = roots.size(); i < e; i += markChunkSize) {
+      SmallVector<InputSection *, 0> chunk(
+          roots.slice(i, std::min(markChunkSize, e - i)));
+      group.spawn([this, chunk = std::move(chunk)] { runTask(chunk); });
+    }
+  }
+  tg = nullptr;
+  queue.clear();
+
+  // Apply the side effects deferred by the worker threads.
+  for (size_t i = 0, e = ctx.arg.threadCount; i != e; ++i) {
+    Worker &w = workers[i];
+    for (Symbol *sym : w.usedSyms)
+      sym->used = true;
+    for (SharedFile *file : w.neededFiles)
+      file->isNeeded = true;
+    for (SectionPiece *piece : w.livePieces)
+      piece->live = true;
   }
+  workers.reset();
 }
 
 // Move the sections for some symbols to the main partition, specifically ifuncs
@@ -13,6 +13,7 @@
 #include "Symbols.h"
 #include "SyntheticSections.h"
 #include "Target.h"
+#include "Writer.h"
 #include "lld/Common/Arrays.h"
 #include "lld/Common/Memory.h"
 #include "llvm/BinaryFormat/Dwarf.h"
@@ -600,7 +601,20 @@ void OutputSection::writeTo(Ctx &ctx, uint8_t *buf, parallel::TaskGroup &tg) {
     taskSize += sections[i]->getSize();
     bool done = ++i == numSections;
     if (done || taskSize >= taskSizeLimit) {
-      tg.spawn([=] { fn(begin, i); });
+      if (OutputHasher *hasher = ctx.outputHasher) {
+        // Let the task tell the build ID hasher which part of the file it
+        // covers, including the gap filled after its last section.
+        uint64_t off = buf - ctx.bufferStart;
+        uint64_t from = off + sections[begin]->outSecOff;
+        uint64_t to = off + (done ? size : sections[i]->outSecOff);
+        hasher->addPending(from, to);
+        tg.spawn([=] {
+          fn(begin, i);
+          hasher->markWritten(from, to);
+        });
+      } else {
+        tg.spawn([=] { fn(begin, i); });
+      }
       if (done)
         break;
       begin = i;
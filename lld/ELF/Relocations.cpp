@@ -1144,9 +1144,9 @@ void RelocationScanner::processAux(RelExpr expr, RelType type, uint64_t offset,
     if (rel != 0) {
       if (ctx.arg.emachine == EM_MIPS && rel == ctx.target->symbolicRel)
         rel = ctx.target->relativeRel;
-      std::lock_guard<std::mutex> lock(ctx.relocMutex);
       Partition &part = sec->getPartition(ctx);
       if (ctx.arg.emachine == EM_AARCH64 && type == R_AARCH64_AUTH_ABS64) {
+        std::lock_guard<std::mutex> lock(ctx.relocMutex);
         // For a preemptible symbol, we can't use a relative relocation. For an
         // undefined symbol, we can't compute offset at link-time and use a
         // relative relocation. Use a symbolic relocation instead.
@@ -1165,7 +1165,17 @@ void RelocationScanner::processAux(RelExpr expr, RelType type, uint64_t offset,
         }
         return;
       }
-      part.relaDyn->addSymbolReloc(rel, *sec, offset, sym, addend, type);
+      // With -z combreloc, computeRels sorts non-relative relocations by
+      // (symbol index, offset), so the order in which threads stage them does
+      // not matter. Buffer them per thread until mergeRels. -z nocombreloc
+      // scans serially and keeps the scan order.
+      if (ctx.arg.zCombreloc) {
+        part.relaDyn->addSymbolReloc<true>(rel, *sec, offset, sym, addend,
+                                           type);
+      } else {
+        std::lock_guard<std::mutex> lock(ctx.relocMutex);
+        part.relaDyn->addSymbolReloc(rel, *sec, offset, sym, addend, type);
+      }
 
       // MIPS ABI turns using of GOT and dynamic relocations inside out.
       // While regular ABI uses dynamic relocations to fill up GOT entries
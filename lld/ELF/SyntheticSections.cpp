@@ -1688,13 +1688,22 @@ RelocationBaseSection::RelocationBaseSection(Ctx &ctx, StringRef name,
       dynamicTag(dynamicTag), sizeDynamicTag(sizeDynamicTag),
       relocsVec(concurrency), combreloc(combreloc) {}
 
+template <bool shard>
 void RelocationBaseSection::addSymbolReloc(
     RelType dynType, InputSectionBase &isec, uint64_t offsetInSec, Symbol &sym,
     int64_t addend, std::optional<RelType> addendRelType) {
-  addReloc(DynamicReloc::AgainstSymbol, dynType, isec, offsetInSec, sym, addend,
-           R_ADDEND, addendRelType ? *addendRelType : ctx.target->noneRel);
+  addReloc<shard>(DynamicReloc::AgainstSymbol, dynType, isec, offsetInSec, sym,
+                  addend, R_ADDEND,
+                  addendRelType ? *addendRelType : ctx.target->noneRel);
 }
 
+template void RelocationBaseSection::addSymbolReloc<false>(
+    RelType, InputSectionBase &, uint64_t, Symbol &, int64_t,
+    std::optional<RelType>);
+template void RelocationBaseSection::addSymbolReloc<true>(
+    RelType, InputSectionBase &, uint64_t, Symbol &, int64_t,
+    std::optional<RelType>);
+
 void RelocationBaseSection::addAddendOnlyRelocIfNonPreemptible(
     RelType dynType, InputSectionBase &isec, uint64_t offsetInSec, Symbol &sym,
     RelType addendRelType) {
@@ -3977,8 +3986,29 @@ void MergeTailSection::finalizeContents() {
 }
 
 void MergeNoTailSection::writeTo(uint8_t *buf) {
-  parallelFor(0, numShards,
-              [&](size_t i) { shards[i].write(buf + shardOffsets[i]); });
+  if (!shards.empty()) {
+    parallelFor(0, numShards,
+                [&](size_t i) { shards[i].write(buf + shardOffsets[i]); });
+    return;
+  }
+
+  // The string table builders were released by --release-merge-tables. Copy
+  // each live piece to its output offset instead. Duplicates of a piece share
+  // a shard and therefore a thread, so identical bytes are never written
+  // concurrently.
+  const size_t concurrency = getConcurrency();
+  parallelFor(0, concurrency, [&](size_t threadId) {
+    for (MergeInputSection *sec : sections) {
+      for (size_t i = 0, e = sec->pieces.size(); i != e; ++i) {
+        const SectionPiece &piece = sec->pieces[i];
+        if (piece.live &&
+            (getShardId(piece.hash) & (concurrency - 1)) == threadId) {
+          StringRef data = sec->getData(i).val();
+          memcpy(buf + piece.outputOff, data.data(), data.size());
+        }
+      }
+    }
+  });
 }
 
 // This function is very hot (i.e. it can take several seconds to finish)
@@ -3994,10 +4024,7 @@ void MergeNoTailSection::finalizeContents() {
   for (size_t i = 0; i < numShards; ++i)
     shards.emplace_back(StringTableBuilder::RAW, llvm::Align(addralign));
 
-  // Concurrency level. Must be a power of 2 to avoid expensive modulo
-  // operations in the following tight loop.
-  const size_t concurrency =
-      llvm::bit_floor(std::min<size_t>(ctx.arg.threadCount, numShards));
+  const size_t concurrency = getConcurrency();
 
   // Add section pieces to the builders.
   parallelFor(0, concurrency, [&](size_t threadId) {
@@ -4030,6 +4057,12 @@ void MergeNoTailSection::finalizeContents() {
       if (piece.live)
         piece.outputOff += shardOffsets[getShardId(piece.hash)];
   });
+
+  // Every piece now knows its output offset, so with --release-merge-tables
+  // the dedup tables, which hold an entry per unique piece, are no longer
+  // needed. writeTo copies the pieces from the input sections instead.
+  if (ctx.arg.releaseMergeTables)
+    shards.clear();
 }
 
 template <class ELFT> void elf::splitSections(Ctx &ctx) {
@@ -515,6 +515,7 @@ public:
     relocs.push_back(reloc);
   }
   /// Add a dynamic relocation against \p sym with an optional addend.
+  template <bool shard = false>
   void addSymbolReloc(RelType dynType, InputSectionBase &isec,
                       uint64_t offsetInSec, Symbol &sym, int64_t addend = 0,
                       std::optional<RelType> addendRelType = {});
@@ -1139,6 +1140,12 @@ private:
     return hash >> (31 - llvm::countr_zero(numShards));
   }
 
+  // The number of threads that dedup pieces. Must be a power of 2 to avoid
+  // expensive modulo operations in the tight loops over pieces.
+  size_t getConcurrency() const {
+    return llvm::bit_floor(std::min<size_t>(ctx.arg.threadCount, numShards));
+  }
+
   // Section size
   size_t size;
 
@@ -21,7 +21,6 @@
 #include "Symbols.h"
 #include "SyntheticSections.h"
 #include "Target.h"
-#include "lld/Common/Arrays.h"
 #include "lld/Common/CommonLinkerContext.h"
 #include "lld/Common/Filesystem.h"
 #include "lld/Common/Strings.h"
@@ -81,6 +80,7 @@ private:
   void writeSections();
   void writeSectionsBinary();
   void writeBuildId();
+  std::optional<OutputHasher::HashFn> getBuildIdHashFn();
 
   Ctx &ctx;
   std::unique_ptr<FileOutputBuffer> &buffer;
@@ -93,6 +93,8 @@ private:
 
   uint64_t fileSize;
   uint64_t sectionHeaderOff;
+  // Set by writeSections if the build ID is hashed while writing.
+  std::unique_ptr<OutputHasher> hasher;
 };
 } // anonymous namespace
 
@@ -1098,7 +1100,7 @@ static DenseMap<const InputSectionBase *, int> buildSectionOrder(Ctx &ctx) {
         ctx.arg.bpFunctionOrderForCompression,
         ctx.arg.bpDataOrderForCompression,
         ctx.arg.bpCompressionSortStartupFunctions,
-        ctx.arg.bpVerboseSectionOrderer);
+        ctx.arg.bpVerboseSectionOrderer, ctx.arg.bpCachePath);
   } else if (!ctx.arg.callGraphProfile.empty()) {
     sectionOrder = computeCallGraphProfileOrder(ctx);
   }
@@ -3004,12 +3006,26 @@ template <class ELFT> void Writer<ELFT>::writeSections() {
       if (isStaticRelSecType(sec->type))
         sec->writeTo<ELFT>(ctx, ctx.bufferStart + sec->offset, tg);
   }
+  // If the build ID is a hash of the output, hash each chunk of the file as
+  // soon as its last write finishes. The relocation sections written above
+  // may have modified the relocated sections, so only the writes below are
+  // tracked.
+  std::optional<OutputHasher::HashFn> hashFn = getBuildIdHashFn();
+  if (hashFn) {
+    hasher = std::make_unique<OutputHasher>(
+        ctx, ArrayRef<uint8_t>(ctx.bufferStart, fileSize),
+        ctx.mainPart->buildId->hashSize, std::move(*hashFn));
+    ctx.outputHasher = hasher.get();
+  }
   {
     parallel::TaskGroup tg;
     for (OutputSection *sec : ctx.outputSections)
       if (!isStaticRelSecType(sec->type))
         sec->writeTo<ELFT>(ctx, ctx.bufferStart + sec->offset, tg);
+    if (hasher)
+      hasher->releaseAll();
   }
+  ctx.outputHasher = nullptr;
 
   // Finally, check that all dynamic relocation addends were written correctly.
   if (ctx.arg.checkDynamicRelocs && ctx.arg.writeAddends) {
@@ -3019,42 +3035,50 @@ template <class ELFT> void Writer<ELFT>::writeSections() {
   }
 }
 
-// Computes a hash value of Data using a given hash function.
-// In order to utilize multiple cores, we first split data into 1MB
-// chunks, compute a hash for each chunk, and then compute a hash value
-// of the hash values.
-static void
-computeHash(llvm::MutableArrayRef<uint8_t> hashBuf,
-            llvm::ArrayRef<uint8_t> data,
-            std::function<void(uint8_t *dest, ArrayRef<uint8_t> arr)> hashFn) {
-  std::vector<ArrayRef<uint8_t>> chunks = split(data, 1024 * 1024);
-  const size_t hashesSize = chunks.size() * hashBuf.size();
-  std::unique_ptr<uint8_t[]> hashes(new uint8_t[hashesSize]);
-
-  // Compute hash values.
-  parallelFor(0, chunks.size(), [&](size_t i) {
-    hashFn(hashes.get() + i * hashBuf.size(), chunks[i]);
-  });
-
-  // Write to the final output buffer.
-  hashFn(hashBuf.data(), ArrayRef(hashes.get(), hashesSize));
+OutputHasher::OutputHasher(Ctx &ctx, ArrayRef<uint8_t> data, size_t hashSize,
+                           HashFn hashFn)
+    : ctx(ctx), data(data), hashSize(hashSize),
+      numChunks(divideCeil(data.size(), chunkSize)),
+      hashFn(std::move(hashFn)),
+      pending(new std::atomic<uint32_t>[numChunks]),
+      hashes(new uint8_t[numChunks * hashSize]) {
+  for (size_t i = 0; i != numChunks; ++i)
+    pending[i].store(1, std::memory_order_relaxed);
 }
 
-template <class ELFT> void Writer<ELFT>::writeBuildId() {
-  if (!ctx.mainPart->buildId || !ctx.mainPart->buildId->getParent())
+void OutputHasher::addPending(uint64_t begin, uint64_t end) {
+  if (begin == end)
     return;
+  for (size_t i = begin / chunkSize, e = (end - 1) / chunkSize; i <= e; ++i)
+    pending[i].fetch_add(1, std::memory_order_relaxed);
+}
 
-  if (ctx.arg.buildId == BuildIdKind::Hexstring) {
-    for (Partition &part : ctx.partitions)
-      part.buildId->writeBuildId(ctx.arg.buildIdVector);
+void OutputHasher::markWritten(uint64_t begin, uint64_t end) {
+  if (begin == end)
     return;
-  }
+  for (size_t i = begin / chunkSize, e = (end - 1) / chunkSize; i <= e; ++i)
+    release(i);
+}
 
-  // Compute a hash of all sections of the output file.
-  size_t hashSize = ctx.mainPart->buildId->hashSize;
-  std::unique_ptr<uint8_t[]> buildId(new uint8_t[hashSize]);
-  MutableArrayRef<uint8_t> output(buildId.get(), hashSize);
-  llvm::ArrayRef<uint8_t> input{ctx.bufferStart, size_t(fileSize)};
+void OutputHasher::releaseAll() {
+  // Chunks that still have writes in flight are hashed by the task finishing
+  // the last one.
+  unsigned numThreads =
+      getPhaseThreadCount(ctx, LinkPhase::BuildId, data.size());
+  parallelForN(numThreads, 0, numChunks, [&](size_t i) { release(i); });
+}
+
+void OutputHasher::finish(MutableArrayRef<uint8_t> hashBuf) {
+  assert(hashBuf.size() == hashSize);
+  hashFn(hashBuf.data(), ArrayRef(hashes.get(), numChunks * hashSize));
+}
+
+// Returns the function that hashes a chunk of the output for --build-id, or
+// std::nullopt if the build ID is not a hash of the output.
+template <class ELFT>
+std::optional<OutputHasher::HashFn> Writer<ELFT>::getBuildIdHashFn() {
+  if (!ctx.mainPart->buildId || !ctx.mainPart->buildId->getParent())
+    return std::nullopt;
 
   // Fedora introduced build ID as "approximation of true uniqueness across all
   // binaries that might be used by overlapping sets of people". It does not
@@ -3062,28 +3086,56 @@ template <class ELFT> void Writer<ELFT>::writeBuildId() {
   // (second-)preimage and collision resistance. In practice people use 'md5'
   // and 'sha1' just for different lengths. Implement them with the more
   // efficient BLAKE3.
+  size_t hashSize = ctx.mainPart->buildId->hashSize;
   switch (ctx.arg.buildId) {
   case BuildIdKind::Fast:
-    computeHash(output, input, [](uint8_t *dest, ArrayRef<uint8_t> arr) {
+    return [](uint8_t *dest, ArrayRef<uint8_t> arr) {
       write64le(dest, xxh3_64bits(arr));
-    });
-    break;
+    };
   case BuildIdKind::Md5:
-    computeHash(output, input, [&](uint8_t *dest, ArrayRef<uint8_t> arr) {
+    return [=](uint8_t *dest, ArrayRef<uint8_t> arr) {
       memcpy(dest, BLAKE3::hash<16>(arr).data(), hashSize);
-    });
-    break;
+    };
   case BuildIdKind::Sha1:
-    computeHash(output, input, [&](uint8_t *dest, ArrayRef<uint8_t> arr) {
+    return [=](uint8_t *dest, ArrayRef<uint8_t> arr) {
       memcpy(dest, BLAKE3::hash<20>(arr).data(), hashSize);
-    });
-    break;
-  case BuildIdKind::Uuid:
+    };
+  default:
+    return std::nullopt;
+  }
+}
+
+template <class ELFT> void Writer<ELFT>::writeBuildId() {
+  if (!ctx.mainPart->buildId || !ctx.mainPart->buildId->getParent())
+    return;
+
+  if (ctx.arg.buildId == BuildIdKind::Hexstring) {
+    for (Partition &part : ctx.partitions)
+      part.buildId->writeBuildId(ctx.arg.buildIdVector);
+    return;
+  }
+
+  // Compute a hash of all sections of the output file.
+  size_t hashSize = ctx.mainPart->buildId->hashSize;
+  std::unique_ptr<uint8_t[]> buildId(new uint8_t[hashSize]);
+  MutableArrayRef<uint8_t> output(buildId.get(), hashSize);
+
+  if (ctx.arg.buildId == BuildIdKind::Uuid) {
     if (auto ec = llvm::getRandomBytes(buildId.get(), hashSize))
       ErrAlways(ctx) << "entropy source failure: " << ec.message();
-    break;
-  default:
-    llvm_unreachable("unknown BuildIdKind");
+  } else {
+    // writeSectionsBinary does not overlap hashing with writing, so hash the
+    // whole file now.
+    if (!hasher) {
+      std::optional<OutputHasher::HashFn> hashFn = getBuildIdHashFn();
+      if (!hashFn)
+        llvm_unreachable("unknown BuildIdKind");
+      hasher = std::make_unique<OutputHasher>(
+          ctx, ArrayRef<uint8_t>(ctx.bufferStart, fileSize), hashSize,
+          std::move(*hashFn));
+      hasher->releaseAll();
+    }
+    hasher->finish(output);
   }
   for (Partition &part : ctx.partitions)
     part.buildId->writeBuildId(output);
@@ -10,6 +10,8 @@
 #define LLD_ELF_WRITER_H
 
 #include "Config.h"
+#include <atomic>
+#include <functional>
 
 namespace lld::elf {
 class OutputSection;
@@ -20,6 +22,51 @@ void addReservedSymbols(Ctx &ctx);
 bool includeInSymtab(Ctx &, const Symbol &);
 unsigned getSectionRank(Ctx &, OutputSection &osec);
 
+// Computes the --build-id hash of the output file. The file is split into 1 MiB
+// chunks, each chunk is hashed, and the build ID is the hash of the chunk
+// hashes. While sections are being written, a chunk is hashed by the thread
+// that finishes the last write overlapping it, so that hashing overlaps with
+// writing rather than following it.
+class OutputHasher {
+public:
+  using HashFn =
+      std::function<void(uint8_t *dest, llvm::ArrayRef<uint8_t> arr)>;
+  static constexpr size_t chunkSize = 1024 * 1024;
+
+  OutputHasher(Ctx &ctx, llvm::ArrayRef<uint8_t> data, size_t hashSize,
+               HashFn hashFn);
+
+  // Records that [begin, end) of the file will be written asynchronously.
+  void addPending(uint64_t begin, uint64_t end);
+  // Records that an asynchronous write of [begin, end) has finished.
+  void markWritten(uint64_t begin, uint64_t end);
+  // Called once every asynchronous write has been issued. Hashes the chunks
+  // that have no write in flight.
+  void releaseAll();
+  // Called once every write has finished. Writes the build ID to hashBuf.
+  void finish(llvm::MutableArrayRef<uint8_t> hashBuf);
+
+private:
+  void release(size_t chunk) {
+    if (pending[chunk].fetch_sub(1, std::memory_order_acq_rel) == 1)
+      hashFn(hashes.get() + chunk * hashSize, getChunk(chunk));
+  }
+  llvm::ArrayRef<uint8_t> getChunk(size_t chunk) const {
+    return data.slice(chunk * chunkSize,
+                      std::min(chunkSize, data.size() - chunk * chunkSize));
+  }
+
+  Ctx &ctx;
+  llvm::ArrayRef<uint8_t> data;
+  size_t hashSize;
+  size_t numChunks;
+  HashFn hashFn;
+  // The number of outstanding writes of each chunk, plus one that is dropped
+  // by releaseAll.
+  std::unique_ptr<std::atomic<uint32_t>[]> pending;
+  std::unique_ptr<uint8_t[]> hashes;
+};
+
 } // namespace lld::elf
 
 #endif
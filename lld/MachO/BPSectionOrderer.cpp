@@ -31,6 +31,7 @@ template <> struct lld::BPOrdererTraits<struct BPOrdererMachO> {
 namespace {
 struct BPOrdererMachO : lld::BPOrderer<BPOrdererMachO> {
   static uint64_t getSize(const Section &sec) { return sec.getSize(); }
+  static ArrayRef<uint8_t> getContent(const Section &sec) { return sec.data; }
   static bool isCodeSection(const Section &sec) {
     return macho::isCodeSection(&sec);
   }
@@ -107,7 +108,7 @@ private:
 
 DenseMap<const InputSection *, int> lld::macho::runBalancedPartitioning(
     StringRef profilePath, bool forFunctionCompression, bool forDataCompression,
-    bool compressionSortStartupFunctions, bool verbose) {
+    bool compressionSortStartupFunctions, bool verbose, StringRef cachePath) {
   // Collect candidate sections and associated symbols.
   SmallVector<InputSection *> sections;
   DenseMap<CachedHashStringRef, std::set<unsigned>> rootSymbolToSectionIdxs;
@@ -138,5 +139,6 @@ DenseMap<const InputSection *, int> lld::macho::runBalancedPartitioning(
   return BPOrdererMachO().computeOrder(profilePath, forFunctionCompression,
                                        forDataCompression,
                                        compressionSortStartupFunctions, verbose,
-                                       sections, rootSymbolToSectionIdxs);
+                                       cachePath, sections,
+                                       rootSymbolToSectionIdxs);
 }
@@ -28,7 +28,8 @@ class InputSection;
 llvm::DenseMap<const InputSection *, int>
 runBalancedPartitioning(llvm::StringRef profilePath,
                         bool forFunctionCompression, bool forDataCompression,
-                        bool compressionSortStartupFunctions, bool verbose);
+                        bool compressionSortStartupFunctions, bool verbose,
+                        llvm::StringRef cachePath);
 
 } // namespace lld::macho
 
@@ -231,6 +231,7 @@ struct Configuration {
   bool bpFunctionOrderForCompression = false;
   bool bpDataOrderForCompression = false;
   bool bpVerboseSectionOrderer = false;
+  llvm::StringRef bpCachePath;
 
   SectionRenameMap sectionRenameMap;
   SegmentRenameMap segmentRenameMap;
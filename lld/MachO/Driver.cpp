@@ -1215,6 +1215,21 @@ static void handleSymbolPatterns(InputArgList &args,
     parseSymbolPatternsFile(arg, symbolPatterns);
 }
 
+// Parses the relocations that were deferred while createFiles() resolved
+// symbols. Each file only reads its own symbols and sections, so this runs in
+// parallel.
+static void parseDeferredRelocations() {
+  TimeTraceScope timeScope("Parse relocations");
+  parallelForEach(inputFiles.getArrayRef(), [](InputFile *file) {
+    if (auto *objFile = dyn_cast<ObjFile>(file)) {
+      if (target->wordSize == 8)
+        objFile->parseDeferredRelocations<LP64>();
+      else
+        objFile->parseDeferredRelocations<ILP32>();
+    }
+  });
+}
+
 static void createFiles(const InputArgList &args) {
   TimeTraceScope timeScope("Load input files");
   // This loop should be reserved for options whose exact ordering matters.
@@ -1884,6 +1899,16 @@ bool link(ArrayRef<const char *> argsArr, llvm::raw_ostream &stdoutOS,
       IncompatWithCGSort(arg->getSpelling());
   }
   config->bpVerboseSectionOrderer = args.hasArg(OPT_verbose_bp_section_orderer);
+  if (const Arg *arg = args.getLastArg(OPT_bp_cache)) {
+    config->bpCachePath = arg->getValue();
+    if (config->bpCachePath.empty())
+      error(arg->getSpelling() + ": expected a file name");
+    else if (!config->bpStartupFunctionSort &&
+             !config->bpFunctionOrderForCompression &&
+             !config->bpDataOrderForCompression)
+      error("--bp-cache must be used with --bp-startup-sort=function or "
+            "--bp-compression-sort");
+  }
 
   for (const Arg *arg : args.filtered(OPT_alias)) {
     config->aliasedSymbols.push_back(
@@ -2107,7 +2132,10 @@ bool link(ArrayRef<const char *> argsArr, llvm::raw_ostream &stdoutOS,
     TimeTraceScope timeScope("ExecuteLinker");
 
     initLLVM(); // must be run before any call to addFile()
+    ObjFile::deferRelocations = true;
     createFiles(args);
+    ObjFile::deferRelocations = false;
+    parseDeferredRelocations();
 
     // Now that all dylibs have been loaded, search for those that should be
     // re-exported.
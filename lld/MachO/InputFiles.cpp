@@ -62,6 +62,7 @@
 #include "llvm/ADT/iterator.h"
 #include "llvm/BinaryFormat/MachO.h"
 #include "llvm/LTO/LTO.h"
+#include "llvm/Object/IRObjectFile.h"
 #include "llvm/Support/BinaryStreamReader.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/MemoryBuffer.h"
@@ -981,6 +982,32 @@ ObjFile::ObjFile(MemoryBufferRef mb, uint32_t modTime, StringRef archiveName,
   }
 }
 
+bool ObjFile::deferRelocations = false;
+
+// Returns true if the relocations of sec are needed while this file is parsed.
+static bool hasEagerRelocations(const Section &sec) {
+  return sec.name == section_names::compactUnwind ||
+         sec.name == section_names::ehFrame;
+}
+
+template <class LP> void ObjFile::parseDeferredRelocations() {
+  using SegmentCommand = typename LP::segment_command;
+  using SectionHeader = typename LP::section;
+
+  if (!hasDeferredRelocations)
+    return;
+  hasDeferredRelocations = false;
+
+  const load_command *cmd = findCommand(mb.getBufferStart(), LP::segmentLCType);
+  auto *c = reinterpret_cast<const SegmentCommand *>(cmd);
+  ArrayRef<SectionHeader> sectionHeaders(
+      reinterpret_cast<const SectionHeader *>(c + 1), c->nsects);
+  for (size_t i = 0, n = sections.size(); i < n; ++i)
+    if (!sections[i]->subsections.empty() &&
+        !hasEagerRelocations(*sections[i]))
+      parseRelocations(sectionHeaders, sectionHeaders[i], *sections[i]);
+}
+
 template <class LP> void ObjFile::parse() {
   using Header = typename LP::mach_header;
   using SegmentCommand = typename LP::segment_command;
@@ -1022,9 +1049,14 @@ template <class LP> void ObjFile::parse() {
 
   // The relocations may refer to the symbols, so we parse them after we have
   // parsed all the symbols.
-  for (size_t i = 0, n = sections.size(); i < n; ++i)
-    if (!sections[i]->subsections.empty())
+  for (size_t i = 0, n = sections.size(); i < n; ++i) {
+    if (sections[i]->subsections.empty())
+      continue;
+    if (deferRelocations && !hasEagerRelocations(*sections[i]))
+      hasDeferredRelocations = true;
+    else
       parseRelocations(sectionHeaders, sectionHeaders[i], *sections[i]);
+  }
 
   parseDebugInfo();
 
@@ -2353,13 +2385,12 @@ BitcodeFile::BitcodeFile(MemoryBufferRef mb, StringRef archiveName,
   // So, we append the archive name to disambiguate two members with the same
   // name from multiple different archives, and offset within the archive to
   // disambiguate two members of the same name from a single archive.
-  MemoryBufferRef mbref(mb.getBuffer(),
-                        saver().save(archiveName.empty()
-                                         ? path
-                                         : archiveName + "(" +
-                                               sys::path::filename(path) + ")" +
-                                               utostr(offsetInArchive)));
-  obj = check(lto::InputFile::create(mbref));
+  ltoBuffer = MemoryBufferRef(
+      mb.getBuffer(),
+      saver().save(archiveName.empty() ? path
+                                       : archiveName + "(" +
+                                             sys::path::filename(path) + ")" +
+                                             utostr(offsetInArchive)));
   if (lazy)
     parseLazy();
   else
@@ -2367,6 +2398,9 @@ BitcodeFile::BitcodeFile(MemoryBufferRef mb, StringRef archiveName,
 }
 
 void BitcodeFile::parse() {
+  if (!obj)
+    obj = check(lto::InputFile::create(ltoBuffer));
+
   // Convert LTO Symbols to LLD Symbols in order to perform resolution. The
   // "winning" symbol will then be marked as Prevailing at LTO compilation
   // time.
@@ -2383,10 +2417,13 @@ void BitcodeFile::parse() {
 }
 
 void BitcodeFile::parseLazy() {
-  symbols.resize(obj->symbols().size());
-  for (const auto &[i, objSym] : llvm::enumerate(obj->symbols())) {
-    if (!objSym.isUndefined()) {
-      symbols[i] = symtab->addLazyObject(saver().save(objSym.getName()), *this);
+  // Most lazy members are never extracted, so only read the irsymtab here.
+  // lto::InputFile is created by parse() if one of these names is needed.
+  object::IRSymtabFile symtabFile = check(object::readIRSymtab(ltoBuffer));
+  for (const irsymtab::Reader::SymbolRef &irSym :
+       symtabFile.TheReader.symbols()) {
+    if (!irSym.isUndefined()) {
+      symtab->addLazyObject(saver().save(irSym.getName()), *this);
       if (!lazy)
         break;
     }
@@ -2418,3 +2455,5 @@ void macho::extract(InputFile &file, StringRef reason) {
 }
 
 template void ObjFile::parse<LP64>();
+template void ObjFile::parseDeferredRelocations<LP64>();
+template void ObjFile::parseDeferredRelocations<ILP32>();
@@ -167,9 +167,19 @@ public:
   template <class LP> void parse();
   template <class LP>
   void parseLinkerOptions(llvm::SmallVectorImpl<StringRef> &LinkerOptions);
+  // Parses the relocations that parse() left for later; see
+  // deferRelocations.
+  template <class LP> void parseDeferredRelocations();
 
   static bool classof(const InputFile *f) { return f->kind() == ObjKind; }
 
+  // Symbol resolution does not look at relocations, except for those of
+  // __compact_unwind and __eh_frame, which are consumed when the file is
+  // parsed. While this is set, parse() leaves the other relocations unparsed
+  // so that they can be parsed for many files in parallel once symbol
+  // resolution has loaded them.
+  static bool deferRelocations;
+
   std::string sourceFile() const;
   // Parses line table information for diagnostics. compileUnit should be used
   // for other purposes.
@@ -203,6 +213,8 @@ private:
   void splitEhFrames(ArrayRef<uint8_t> dataArr, Section &ehFrameSection);
   void registerCompactUnwind(Section &compactUnwindSection);
   void registerEhFrames(Section &ehFrameSection);
+
+  bool hasDeferredRelocations = false;
 };
 
 // command-line -sectcreate file
@@ -316,7 +328,10 @@ public:
   static bool classof(const InputFile *f) { return f->kind() == BitcodeKind; }
   void parse();
 
+  // Created by parse(); lazy members that are never extracted don't have one.
   std::unique_ptr<llvm::lto::InputFile> obj;
+  // The uniquely named buffer handed to LTO.
+  llvm::MemoryBufferRef ltoBuffer;
   bool forceHidden;
 
 private:
@@ -371,7 +371,7 @@ macho::PriorityBuilder::buildInputSectionPriorities() {
         config->bpFunctionOrderForCompression,
         config->bpDataOrderForCompression,
         config->bpCompressionSortStartupFunctions,
-        config->bpVerboseSectionOrderer);
+        config->bpVerboseSectionOrderer, config->bpCachePath);
   } else if (config->callGraphProfileSort) {
     // Sort sections by the profile data provided by __LLVM,__cg_profile
     // sections.
@@ -471,7 +471,8 @@ void UnwindInfoSectionImpl::finalize() {
   // vector of indices to entries and sort & fold that instead.
   cuIndices.resize(cuEntries.size());
   std::iota(cuIndices.begin(), cuIndices.end(), 0);
-  llvm::sort(cuIndices, [&](size_t a, size_t b) {
+  // Function addresses are unique, so the parallel sort is deterministic.
+  parallelSort(cuIndices, [&](size_t a, size_t b) {
     return cuEntries[a].functionAddress < cuEntries[b].functionAddress;
   });
 
@@ -690,9 +691,12 @@ void UnwindInfoSectionImpl::writeTo(uint8_t *buf) const {
     lep++;
   }
 
-  // Level-2 pages
-  auto *pp = reinterpret_cast<uint32_t *>(lep);
-  for (const SecondLevelPage &page : secondLevelPages) {
+  // Level-2 pages. Each page is self-contained, so they are encoded in
+  // parallel.
+  auto *pagesBuf = reinterpret_cast<uint32_t *>(lep);
+  parallelFor(0, secondLevelPages.size(), [&](size_t pageIdx) {
+    const SecondLevelPage &page = secondLevelPages[pageIdx];
+    uint32_t *pp = pagesBuf + pageIdx * SECOND_LEVEL_PAGE_WORDS;
     if (page.kind == UNWIND_SECOND_LEVEL_COMPRESSED) {
       uintptr_t functionAddressBase =
           cuEntries[cuIndices[page.entryIndex]].functionAddress;
@@ -734,8 +738,7 @@ void UnwindInfoSectionImpl::writeTo(uint8_t *buf) const {
         *ep++ = cue.encoding;
       }
     }
-    pp += SECOND_LEVEL_PAGE_WORDS;
-  }
+  });
 }
 
 UnwindInfoSection *macho::makeUnwindInfoSection() {
@@ -0,0 +1,75 @@
+# REQUIRES: x86
+## --bp-cache= saves the balanced partitioning order and reuses it when the
+## inputs, profile and options have not changed.
+
+# RUN: rm -rf %t && split-file %s %t && cd %t
+# RUN: llvm-mc -filetype=obj -triple=x86_64 a.s -o a.o
+
+# RUN: ld.lld a.o --bp-compression-sort=function --bp-cache=cache -o out1
+# RUN: FileCheck %s --input-file=cache --check-prefix=CACHE
+# CACHE:      lld-bp-order-cache-v1 {{[0-9a-f]+$}}
+# CACHE-NEXT: {{^[0-9a-f]+$}}
+
+## The second link reuses the order and produces the same output.
+# RUN: ld.lld a.o --bp-compression-sort=function --bp-cache=cache \
+# RUN:   --verbose-bp-section-orderer -o out2 2>&1 | FileCheck %s --check-prefix=REUSE
+# RUN: cmp out1 out2
+# REUSE: Reused the balanced partitioning order of {{[1-9][0-9]*}} sections (0 removed, 0 added)
+
+## Different options do not reuse the order.
+# RUN: ld.lld a.o --bp-compression-sort=both --bp-cache=cache \
+# RUN:   --verbose-bp-section-orderer -o out3 2>&1 | FileCheck %s --check-prefix=NOREUSE
+# NOREUSE-NOT: Reused the balanced partitioning order
+
+## A corrupt cache is ignored and rewritten.
+# RUN: echo garbage > cache
+# RUN: ld.lld a.o --bp-compression-sort=function --bp-cache=cache -o out4
+# RUN: cmp out1 out4
+# RUN: FileCheck %s --input-file=cache --check-prefix=CACHE
+
+# RUN: ld.lld a.o --bp-compression-sort=function --bp-cache=nonexistent/cache \
+# RUN:   -o out5 2>&1 | FileCheck %s --check-prefix=WARN
+# RUN: cmp out1 out5
+# WARN: warning: cannot write balanced partitioning cache nonexistent/cache:
+
+# RUN: not ld.lld a.o --bp-compression-sort=function --bp-cache= 2>&1 | \
+# RUN:   FileCheck %s --check-prefix=ERR-EMPTY
+# ERR-EMPTY: error: --bp-cache=: expected a file name
+# RUN: not ld.lld a.o --bp-cache=cache 2>&1 | FileCheck %s --check-prefix=ERR-SORT
+# ERR-SORT: error: --bp-cache must be used with --bp-startup-sort=function or --bp-compression-sort
+
+#--- a.s
+.globl _start, f1, f2, f3, f4
+.section .text._start,"ax",@progbits
+_start:
+  call f1
+  call f2
+  call f3
+  call f4
+  ret
+
+.section .text.f1,"ax",@progbits
+f1:
+  addq $1, %rax
+  addq $2, %rcx
+  ret
+
+.section .text.f2,"ax",@progbits
+f2:
+  subq $3, %rdx
+  subq $4, %rsi
+  ret
+
+.section .text.f3,"ax",@progbits
+f3:
+  addq $1, %rax
+  addq $2, %rcx
+  subq $5, %rdi
+  ret
+
+.section .text.f4,"ax",@progbits
+f4:
+  subq $3, %rdx
+  subq $4, %rsi
+  subq $6, %r8
+  ret
@@ -0,0 +1,61 @@
+# REQUIRES: x86
+## --icf-hot-threshold= keeps sections whose call graph profile weight exceeds
+## the threshold out of ICF.
+
+# RUN: rm -rf %t && split-file %s %t && cd %t
+# RUN: llvm-mc -filetype=obj -triple=x86_64 a.s -o a.o
+
+## foo has weight 200 and stays unfolded. bar and baz are folded.
+# RUN: ld.lld a.o -o out --icf=all --print-icf-sections \
+# RUN:   --call-graph-ordering-file=cg.txt --icf-hot-threshold=100 | \
+# RUN:   FileCheck %s --check-prefix=HOT
+# HOT:      selected section a.o:(.text.bar)
+# HOT-NEXT:   removing identical section a.o:(.text.baz)
+# HOT-NEXT: not folding hot section a.o:(.text.foo) (profile weight 200)
+# HOT-NEXT: ICF folded 1 sections (1 bytes) and kept 1 hot sections (1 bytes) unfolded
+# HOT-NOT:  {{.}}
+
+# RUN: llvm-nm out | FileCheck %s --check-prefix=SYM
+# SYM:      [[BAR:[0-9a-f]+]] T bar
+# SYM-NEXT: [[BAR]] T baz
+
+## A section whose weight equals the threshold is not hot.
+# RUN: ld.lld a.o -o out2 --icf=all --print-icf-sections \
+# RUN:   --call-graph-ordering-file=cg.txt --icf-hot-threshold=200 | \
+# RUN:   FileCheck %s --check-prefix=COLD
+# COLD:      selected section a.o:(.text.foo)
+# COLD-NEXT:   removing identical section a.o:(.text.bar)
+# COLD-NEXT:   removing identical section a.o:(.text.baz)
+# COLD-NEXT: ICF folded 2 sections (2 bytes) and kept 0 hot sections (0 bytes) unfolded
+
+# RUN: not ld.lld a.o --icf=all --icf-hot-threshold=abc 2>&1 | \
+# RUN:   FileCheck %s --check-prefix=ERR1
+# ERR1: error: --icf-hot-threshold=: expected a non-negative integer, but got 'abc'
+# RUN: not ld.lld a.o --icf=all --icf-hot-threshold=-5 2>&1 | \
+# RUN:   FileCheck %s --check-prefix=ERR2
+# ERR2: error: --icf-hot-threshold=: expected a non-negative integer, but got '-5'
+
+#--- cg.txt
+foo foo 200
+bar bar 10
+
+#--- a.s
+.globl _start, foo, bar, baz
+.section .text._start,"ax",@progbits
+_start:
+  call foo
+  call bar
+  call baz
+  ret
+
+.section .text.foo,"ax",@progbits
+foo:
+  ret
+
+.section .text.bar,"ax",@progbits
+bar:
+  ret
+
+.section .text.baz,"ax",@progbits
+baz:
+  ret
@@ -0,0 +1,55 @@
+; REQUIRES: x86
+;; --lto-parallel-opt runs only the whole-program part of the regular LTO
+;; pipeline on the merged module and optimizes each codegen partition
+;; separately.
+
+; RUN: rm -rf %t && mkdir %t && cd %t
+; RUN: llvm-as %s -o a.o
+
+;; By default the merged module runs the full LTO pipeline, which drops unused
+;; globals before whole program devirtualization.
+; RUN: ld.lld a.o -o out --lto-partitions=2 --lto-debug-pass-manager 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=FULL
+; FULL:     Running pass: GlobalDCEPass
+; FULL:     Running pass: WholeProgramDevirtPass
+; FULL:     Running pass: InstCombinePass
+
+;; With --lto-parallel-opt, the merged module runs the O0 part and GlobalDCE,
+;; and the partitions run the rest.
+; RUN: ld.lld a.o -o out.par --lto-partitions=2 --lto-parallel-opt \
+; RUN:   --lto-debug-pass-manager 2>&1 | FileCheck %s --check-prefix=PAR
+; PAR-NOT:  Running pass: InstCombinePass
+; PAR:      Running pass: WholeProgramDevirtPass
+; PAR-NOT:  Running pass: InstCombinePass
+; PAR:      Running pass: LowerTypeTestsPass
+; PAR-NOT:  Running pass: InstCombinePass
+; PAR:      Running pass: GlobalDCEPass
+; PAR:      Running pass: InstCombinePass
+
+; RUN: llvm-nm out.par | FileCheck %s --check-prefix=SYM
+; SYM: T _start
+; SYM: T foo
+
+;; The option needs more than one partition.
+; RUN: ld.lld a.o -o out.one --lto-parallel-opt 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=WARN
+; WARN: warning: --lto-parallel-opt has no effect without --lto-partitions= greater than 1
+; RUN: ld.lld a.o -o out.one --lto-parallel-opt --no-lto-parallel-opt \
+; RUN:   --fatal-warnings
+
+; RUN: not ld.lld a.o -o out --lto-parallel-opt=1 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=ERR
+; ERR: error: unknown argument '--lto-parallel-opt=1'
+
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define void @foo(ptr %p) {
+  store i32 1, ptr %p
+  ret void
+}
+
+define void @_start(ptr %p) {
+  call void @foo(ptr %p)
+  ret void
+}
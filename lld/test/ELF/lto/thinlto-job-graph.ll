@@ -0,0 +1,78 @@
+; REQUIRES: x86
+;; --thinlto-job-graph= writes the ThinLTO backend jobs, with the modules each
+;; one imports from, as JSON.
+
+; RUN: rm -rf %t && split-file %s %t && cd %t
+; RUN: opt -module-summary a.ll -o a.o
+; RUN: opt -module-summary b.ll -o b.o
+; RUN: ld.lld a.o b.o -o out --thinlto-job-graph=jobs.json
+; RUN: FileCheck %s --input-file=jobs.json
+
+;; Task 0 is the regular LTO module, so the ThinLTO jobs start at task 1. a.o
+;; imports foo from b.o.
+; CHECK:      {
+; CHECK-NEXT:   "version": 1,
+; CHECK-NEXT:   "jobs": [
+; CHECK-NEXT:     {
+; CHECK-NEXT:       "task": 1,
+; CHECK-NEXT:       "module": "a.o",
+; CHECK-NEXT:       "inputs": [
+; CHECK-NEXT:         "a.o",
+; CHECK-NEXT:         "b.o"
+; CHECK-NEXT:       ],
+; CHECK-NEXT:       "input_bitcode_bytes": {{[1-9][0-9]*}},
+; CHECK-NEXT:       "estimated_instructions": {{[0-9]+}}
+; CHECK-NEXT:     },
+; CHECK-NEXT:     {
+; CHECK-NEXT:       "task": 2,
+; CHECK-NEXT:       "module": "b.o",
+; CHECK-NEXT:       "inputs": [
+; CHECK-NEXT:         "b.o"
+; CHECK-NEXT:       ],
+; CHECK-NEXT:       "input_bitcode_bytes": {{[1-9][0-9]*}},
+; CHECK-NEXT:       "estimated_instructions": {{[0-9]+}}
+; CHECK-NEXT:     }
+; CHECK-NEXT:   ]
+; CHECK-NEXT: }
+
+;; The jobs are written with --thinlto-index-only too.
+; RUN: rm jobs.json
+; RUN: ld.lld a.o b.o --thinlto-index-only --thinlto-job-graph=jobs.json
+; RUN: FileCheck %s --input-file=jobs.json
+
+;; With a module hash, a job also gets its cache key.
+; RUN: opt -module-summary -module-hash a.ll -o a.hash.o
+; RUN: ld.lld a.hash.o b.o -o out.hash --thinlto-job-graph=jobs.hash.json
+; RUN: FileCheck %s --input-file=jobs.hash.json --check-prefix=KEY
+; KEY:      "module": "a.hash.o",
+; KEY:      "estimated_instructions": {{[0-9]+}},
+; KEY-NEXT: "cache_key": "{{[0-9A-F]+}}"
+; KEY:      "module": "b.o",
+; KEY-NOT:  "cache_key"
+
+; RUN: not ld.lld a.o b.o -o out --thinlto-job-graph=nonexistent/jobs.json 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=ERR-WRITE
+; ERR-WRITE: error: {{.*}}nonexistent
+
+; RUN: not ld.lld a.o b.o -o out --thinlto-job-graph= 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=ERR-EMPTY
+; ERR-EMPTY: error: --thinlto-job-graph=: expected a file name
+
+;--- a.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+declare void @foo()
+
+define void @_start() {
+  call void @foo()
+  ret void
+}
+
+;--- b.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define void @foo() {
+  ret void
+}
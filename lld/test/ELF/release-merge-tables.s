@@ -0,0 +1,50 @@
+# REQUIRES: x86
+## --release-merge-tables drops the string merging tables once offsets are
+## assigned and writes the pieces from the input sections. The output must be
+## the same as without it.
+
+# RUN: rm -rf %t && split-file %s %t && cd %t
+# RUN: llvm-mc -filetype=obj -triple=x86_64 a.s -o a.o
+# RUN: llvm-mc -filetype=obj -triple=x86_64 b.s -o b.o
+# RUN: ld.lld a.o b.o -o out
+# RUN: ld.lld a.o b.o --release-merge-tables -o out.release
+# RUN: cmp out out.release
+# RUN: llvm-readelf -S out.release | FileCheck %s
+
+## The pieces are deduplicated within and across input sections: "abc", "def"
+## and "ghi" once each.
+# CHECK: .rodata PROGBITS {{[0-9a-f]+}} {{[0-9a-f]+}} 00000c 01 AMS
+
+# RUN: ld.lld -r a.o b.o --release-merge-tables -o out.r.release
+# RUN: ld.lld -r a.o b.o -o out.r
+# RUN: cmp out.r out.r.release
+
+# RUN: not ld.lld a.o b.o --release-merge-tables=1 2>&1 | FileCheck %s --check-prefix=ERR
+# ERR: error: unknown argument '--release-merge-tables=1'
+
+#--- a.s
+.globl _start
+_start:
+  leaq .L.abc(%rip), %rax
+  leaq .L.def(%rip), %rcx
+  leaq .L.abc2(%rip), %rdx
+
+.section .rodata.str1.1,"aMS",@progbits,1
+.L.abc:
+  .asciz "abc"
+.L.def:
+  .asciz "def"
+.L.abc2:
+  .asciz "abc"
+
+#--- b.s
+.globl foo
+foo:
+  leaq .L.def(%rip), %rax
+  leaq .L.ghi(%rip), %rcx
+
+.section .rodata.str1.1,"aMS",@progbits,1
+.L.def:
+  .asciz "def"
+.L.ghi:
+  .asciz "ghi"
@@ -16,6 +16,7 @@
 #include "lld/Common/Memory.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Support/LEB128.h"
+#include "llvm/Support/Parallel.h"
 
 #define DEBUG_TYPE "lld"
 
@@ -62,7 +63,27 @@ void CodeSection::finalizeContents() {
   createHeader(bodySize);
 }
 
-void CodeSection::writeTo(uint8_t *buf) {
+// Spawn tasks into `tg` that call `write` on consecutive runs of `items`. Each
+// run covers at least 4 MiB, as in ELF's OutputSection::writeTo, since a task
+// per item would be too fine-grained for sections with many small functions.
+template <class T, class SizeFn, class WriteFn>
+static void spawnWrites(llvm::parallel::TaskGroup &tg, ArrayRef<T> items,
+                        SizeFn getSize, WriteFn write) {
+  const size_t taskSizeLimit = 4 << 20;
+  for (size_t begin = 0, i = 0, taskSize = 0, e = items.size(); i != e;) {
+    taskSize += getSize(items[i]);
+    if (++i == e || taskSize >= taskSizeLimit) {
+      tg.spawn([=] {
+        for (size_t j = begin; j != i; ++j)
+          write(items[j]);
+      });
+      begin = i;
+      taskSize = 0;
+    }
+  }
+}
+
+void CodeSection::writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) {
   log("writing " + toString(*this) + " offset=" + Twine(offset) +
       " size=" + Twine(getSize()));
   log(" headersize=" + Twine(header.size()));
@@ -76,9 +97,11 @@ void CodeSection::writeTo(uint8_t *buf) {
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
 
-  // Write code section bodies
-  for (const InputChunk *chunk : functions)
-    chunk->writeTo(buf);
+  // Write code section bodies. Each function is copied and relocated into
+  // its own range of the output, so they can be written in parallel.
+  spawnWrites(
+      tg, functions, [](const InputChunk *chunk) { return chunk->getSize(); },
+      [buf](const InputChunk *chunk) { chunk->writeTo(buf); });
 }
 
 uint32_t CodeSection::getNumRelocations() const {
@@ -160,7 +183,7 @@ void DataSection::finalizeContents() {
   createHeader(bodySize);
 }
 
-void DataSection::writeTo(uint8_t *buf) {
+void DataSection::writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) {
   log("writing " + toString(*this) + " offset=" + Twine(offset) +
       " size=" + Twine(getSize()) + " body=" + Twine(bodySize));
   buf += offset;
@@ -172,17 +195,22 @@ void DataSection::writeTo(uint8_t *buf) {
   // Write data section headers
   memcpy(buf, dataSectionHeader.data(), dataSectionHeader.size());
 
-  for (const OutputSegment *segment : segments) {
-    if (!segment->requiredInBinary())
-      continue;
-    // Write data segment header
-    uint8_t *segStart = buf + segment->sectionOffset;
-    memcpy(segStart, segment->header.data(), segment->header.size());
-
-    // Write segment data payload
-    for (const InputChunk *chunk : segment->inputSegments)
-      chunk->writeTo(buf);
-  }
+  spawnWrites(
+      tg, segments,
+      [](const OutputSegment *segment) {
+        return segment->requiredInBinary() ? segment->size : 0;
+      },
+      [buf](const OutputSegment *segment) {
+        if (!segment->requiredInBinary())
+          return;
+        // Write data segment header
+        uint8_t *segStart = buf + segment->sectionOffset;
+        memcpy(segStart, segment->header.data(), segment->header.size());
+
+        // Write segment data payload
+        for (const InputChunk *chunk : segment->inputSegments)
+          chunk->writeTo(buf);
+      });
 }
 
 uint32_t DataSection::getNumRelocations() const {
@@ -252,7 +280,7 @@ void CustomSection::finalizeContents() {
   createHeader(payloadSize + nameData.size());
 }
 
-void CustomSection::writeTo(uint8_t *buf) {
+void CustomSection::writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) {
   log("writing " + toString(*this) + " offset=" + Twine(offset) +
       " size=" + Twine(getSize()) + " chunks=" + Twine(inputSections.size()));
 
@@ -266,8 +294,10 @@ void CustomSection::writeTo(uint8_t *buf) {
   buf += nameData.size();
 
   // Write custom sections payload
-  for (const InputChunk *section : inputSections)
-    section->writeTo(buf);
+  spawnWrites(
+      tg, ArrayRef(inputSections),
+      [](const InputChunk *section) { return section->getSize(); },
+      [buf](const InputChunk *section) { section->writeTo(buf); });
 }
 
 uint32_t CustomSection::getNumRelocations() const {
@@ -14,6 +14,7 @@
 #include "lld/Common/ErrorHandler.h"
 #include "lld/Common/LLVM.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Parallel.h"
 
 namespace lld {
 
@@ -38,7 +39,9 @@ public:
   virtual bool isNeeded() const { return true; }
   virtual size_t getSize() const = 0;
   virtual size_t getOffset() { return offset; }
-  virtual void writeTo(uint8_t *buf) = 0;
+  // Write the section to `buf`. Large sections spawn the writing of their
+  // contents into `tg` rather than doing it inline.
+  virtual void writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) = 0;
   virtual void finalizeContents() = 0;
   virtual uint32_t getNumRelocations() const { return 0; }
   virtual uint32_t getNumLiveRelocations() const { return getNumRelocations(); }
@@ -64,7 +67,7 @@ public:
   }
 
   size_t getSize() const override { return header.size() + bodySize; }
-  void writeTo(uint8_t *buf) override;
+  void writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) override;
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   bool isNeeded() const override { return functions.size() > 0; }
@@ -87,7 +90,7 @@ public:
   }
 
   size_t getSize() const override { return header.size() + bodySize; }
-  void writeTo(uint8_t *buf) override;
+  void writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) override;
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   bool isNeeded() const override;
@@ -120,7 +123,7 @@ public:
   size_t getSize() const override {
     return header.size() + nameData.size() + payloadSize;
   }
-  void writeTo(uint8_t *buf) override;
+  void writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) override;
   uint32_t getNumRelocations() const override;
   void writeRelocations(raw_ostream &os) const override;
   void finalizeContents() override;
@@ -41,11 +41,13 @@ public:
       writeStr(bodyOutputStream, name, "section name");
   }
 
-  void writeTo(uint8_t *buf) override {
+  void writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) override {
     assert(offset);
     log("writing " + toString(*this));
-    memcpy(buf + offset, header.data(), header.size());
-    memcpy(buf + offset + header.size(), body.data(), body.size());
+    tg.spawn([this, buf] {
+      memcpy(buf + offset, header.data(), header.size());
+      memcpy(buf + offset + header.size(), body.data(), body.size());
+    });
   }
 
   size_t getSize() const override { return header.size() + body.size(); }
@@ -446,14 +448,14 @@ public:
     return ctx.arg.buildId != BuildIdKind::None;
   }
   void writeBuildId(llvm::ArrayRef<uint8_t> buf);
-  void writeTo(uint8_t *buf) override {
+  void writeTo(uint8_t *buf, llvm::parallel::TaskGroup &tg) override {
     LLVM_DEBUG(llvm::dbgs()
                << "BuildId writeto buf " << buf << " offset " << offset
                << " headersize " << header.size() << '\n');
     // The actual build ID is derived from a hash of all of the output
     // sections, so it can't be calculated until they are written. Here
     // we write the section leaving zeros in place of the hash.
-    SyntheticSection::writeTo(buf);
+    SyntheticSection::writeTo(buf, tg);
     // Calculate and store the location where the hash will be written.
     hashPlaceholderPtr = buf + offset + header.size() +
                          +sizeof(buildIdSectionName) /*name string*/ +
@@ -219,10 +219,14 @@ void Writer::writeHeader() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  parallelForEach(outputSections, [buf](OutputSection *s) {
+  // Spawn all the writes into one task group from this thread. A task group
+  // created on a pool thread runs its tasks inline, so the sections must not
+  // be handed to a parallelForEach that then splits them up further.
+  parallel::TaskGroup tg;
+  for (OutputSection *s : outputSections) {
     assert(s->isNeeded());
-    s->writeTo(buf);
-  });
+    s->writeTo(buf, tg);
+  }
 }
 
 // Computes a hash value of Data using a given hash function.
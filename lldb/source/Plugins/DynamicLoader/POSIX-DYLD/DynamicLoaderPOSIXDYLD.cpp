@@ -500,6 +500,8 @@ void DynamicLoaderPOSIXDYLD::RefreshModules() {
           new_modules.Append(module_sp);
         };
 
+    ElapsedTime elapsed(
+        m_process->GetTarget().GetStatistics().GetModuleLoadTime());
     if (m_process->GetTarget().GetParallelModuleLoad()) {
       llvm::ThreadPoolTaskGroup task_group(Debugger::GetThreadPool());
       for (; I != E; ++I)
@@ -720,6 +722,8 @@ void DynamicLoaderPOSIXDYLD::LoadAllCurrentModules() {
           so_entry.base_addr);
     }
   };
+  ElapsedTime elapsed(
+      m_process->GetTarget().GetStatistics().GetModuleLoadTime());
   if (m_process->GetTarget().GetParallelModuleLoad()) {
     llvm::ThreadPoolTaskGroup task_group(Debugger::GetThreadPool());
     for (I = m_rendezvous.begin(), E = m_rendezvous.end(); I != E; ++I)
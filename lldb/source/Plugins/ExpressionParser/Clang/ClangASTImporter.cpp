@@ -10,6 +10,7 @@
 #include "lldb/Utility/LLDBAssert.h"
 #include "lldb/Utility/LLDBLog.h"
 #include "lldb/Utility/Log.h"
+#include "lldb/Utility/Timer.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/Decl.h"
 #include "clang/AST/DeclCXX.h"
@@ -793,6 +794,7 @@ void ClangASTImporter::SetRecordLayout(clang::RecordDecl *decl,
 }
 
 bool ClangASTImporter::CompleteTagDecl(clang::TagDecl *decl) {
+  LLDB_SCOPED_TIMER();
   DeclOrigin decl_origin = GetDeclOrigin(decl);
 
   if (!decl_origin.Valid())
@@ -814,6 +816,7 @@ bool ClangASTImporter::CompleteTagDecl(clang::TagDecl *decl) {
 
 bool ClangASTImporter::CompleteTagDeclWithOrigin(clang::TagDecl *decl,
                                                  clang::TagDecl *origin_decl) {
+  LLDB_SCOPED_TIMER();
   clang::ASTContext *origin_ast_ctx = &origin_decl->getASTContext();
 
   if (!TypeSystemClang::GetCompleteDecl(origin_ast_ctx, origin_decl))
@@ -833,6 +836,7 @@ bool ClangASTImporter::CompleteTagDeclWithOrigin(clang::TagDecl *decl,
 
 bool ClangASTImporter::CompleteObjCInterfaceDecl(
     clang::ObjCInterfaceDecl *interface_decl) {
+  LLDB_SCOPED_TIMER();
   DeclOrigin decl_origin = GetDeclOrigin(interface_decl);
 
   if (!decl_origin.Valid())
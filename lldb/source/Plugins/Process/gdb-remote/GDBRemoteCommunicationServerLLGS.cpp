@@ -32,6 +32,7 @@
 #include "lldb/Target/MemoryRegionInfo.h"
 #include "lldb/Utility/Args.h"
 #include "lldb/Utility/DataBuffer.h"
+#include "lldb/Utility/DataExtractor.h"
 #include "lldb/Utility/Endian.h"
 #include "lldb/Utility/GDBRemote.h"
 #include "lldb/Utility/LLDBAssert.h"
@@ -692,6 +693,56 @@ GetRegistersAsJSON(NativeThreadProtocol &thread) {
   return register_object;
 }
 
+// Append the frame records of the first few frames of \a thread as
+// "memory:<addr>=<bytes>;" pairs. The client seeds its memory cache with these,
+// so that unwinding the innermost frames after a stop does not need a memory
+// read round trip per frame. Only done on targets where the frame pointer
+// points at a {saved frame pointer, return address} pair.
+static void AppendExpeditedFrameMemory(StreamString &response,
+                                       NativeThreadProtocol &thread) {
+  static constexpr unsigned max_expedited_frames = 16;
+
+  NativeProcessProtocol &process = thread.GetProcess();
+  switch (process.GetArchitecture().GetMachine()) {
+  case llvm::Triple::x86:
+  case llvm::Triple::x86_64:
+  case llvm::Triple::aarch64:
+    break;
+  default:
+    return;
+  }
+
+  const uint32_t addr_size = process.GetAddressByteSize();
+  if (addr_size != 4 && addr_size != 8)
+    return;
+
+  uint8_t frame_record[16];
+  const size_t frame_record_size = 2 * addr_size;
+  lldb::addr_t fp = thread.GetRegisterContext().GetFP(0);
+  for (unsigned i = 0; i < max_expedited_frames && fp != 0; ++i) {
+    size_t bytes_read = 0;
+    Status error = process.ReadMemoryWithoutTrap(fp, frame_record,
+                                                 frame_record_size, bytes_read);
+    if (error.Fail() || bytes_read != frame_record_size)
+      break;
+
+    response.Printf("memory:0x%" PRIx64 "=", fp);
+    response.PutBytesAsRawHex8(frame_record, frame_record_size);
+    response.PutChar(';');
+
+    DataExtractor data(frame_record, frame_record_size, process.GetByteOrder(),
+                       addr_size);
+    lldb::offset_t offset = 0;
+    const lldb::addr_t caller_fp = data.GetAddress(&offset);
+    // Stacks grow down, so a caller's frame record must be above this one.
+    // Anything else means the chain is broken or the code has no frame
+    // pointers.
+    if (caller_fp <= fp)
+      break;
+    fp = caller_fp;
+  }
+}
+
 static const char *GetStopReasonString(StopReason stop_reason) {
   switch (stop_reason) {
   case eStopReasonTrace:
@@ -953,6 +1004,11 @@ GDBRemoteCommunicationServerLLGS::PrepareStopReplyPacketForThread(
     }
   }
 
+  // Stepping stops again right away, usually in the same frames, and the
+  // client does not unwind at every step, so don't pay for the frame records.
+  if (tid_stop_info.reason != eStopReasonTrace)
+    AppendExpeditedFrameMemory(response, thread);
+
   const char *reason_str = GetStopReasonString(tid_stop_info.reason);
   if (reason_str != nullptr) {
     response.Printf("reason:%s;", reason_str);
@@ -135,6 +135,10 @@ void ManualDWARFIndex::Index() {
   for (NameToDIE IndexSet<NameToDIE>::*index : indices) {
     task_group.async([this, &sets, index, &progress]() {
       NameToDIE &result = m_set.*index;
+      size_t total = result.GetSize();
+      for (auto &set : sets)
+        total += (set.*index).GetSize();
+      result.Reserve(total);
       for (auto &set : sets)
         result.Append(set.*index);
       result.Finalize();
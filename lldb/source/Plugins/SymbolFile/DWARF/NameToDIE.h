@@ -32,6 +32,12 @@ public:
 
   void Append(const NameToDIE &other);
 
+  size_t GetSize() const { return m_map.GetSize(); }
+
+  /// Reserve space for at least \a n entries, so that appending several
+  /// partial indexes does not reallocate the underlying map repeatedly.
+  void Reserve(size_t n) { m_map.Reserve(n); }
+
   void Finalize();
 
   bool Find(ConstString name,
@@ -146,6 +146,8 @@ TargetStats::ToJSON(Target &target,
     }
     target_metrics_json.try_emplace("targetCreateTime",
                                     m_create_time.get().count());
+    target_metrics_json.try_emplace("moduleLoadTime",
+                                    m_module_load_time.get().count());
 
     json::Array breakpoints_array;
     double totalBreakpointResolveTime = 0.0;
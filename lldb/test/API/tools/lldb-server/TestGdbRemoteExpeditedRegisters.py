@@ -1,4 +1,7 @@
+import re
+
 import gdbremote_testcase
+import lldbgdbserverutils
 from lldbsuite.test.decorators import *
 from lldbsuite.test.lldbtest import *
 from lldbsuite.test import lldbutil
@@ -125,3 +128,74 @@ class TestGdbRemoteExpeditedRegisters(gdbremote_testcase.GdbRemoteTestCaseBase):
         # Ensure the expedited registers contained it.
         self.assertIn(reg_info["lldb_register_index"], expedited_registers)
         self.trace("{} reg_info:{}".format("vg", reg_info))
+
+    def gather_trap_stop_replies(self):
+        # Stop at the trap in the inferior, then single step once. Return the
+        # key/value text of both stop replies.
+        procs = self.prep_debug_monitor_and_inferior(inferior_args=["trap"])
+        self.test_sequence.add_log_lines(
+            [
+                "read packet: $c#63",
+                {
+                    "direction": "send",
+                    "regex": r"^\$T[0-9a-fA-F]{2}([^#]+)#[0-9a-fA-F]{2}$",
+                    "capture": {1: "trap_key_vals_text"},
+                },
+                "read packet: $s#73",
+                {
+                    "direction": "send",
+                    "regex": r"^\$T[0-9a-fA-F]{2}([^#]+)#[0-9a-fA-F]{2}$",
+                    "capture": {1: "step_key_vals_text"},
+                },
+            ],
+            True,
+        )
+        context = self.expect_gdbremote_sequence()
+        self.assertIsNotNone(context)
+        return context.get("trap_key_vals_text"), context.get("step_key_vals_text")
+
+    @skipIf(archs=no_match(["x86_64"]))
+    @skipIf(oslist=no_match(["linux"]))
+    def test_stop_notification_contains_frame_memory(self):
+        self.build()
+        self.set_inferior_startup_launch()
+        trap_key_vals_text, step_key_vals_text = self.gather_trap_stop_replies()
+        self.assertIsNotNone(trap_key_vals_text)
+        self.assertIsNotNone(step_key_vals_text)
+
+        # The inferior is built with frame pointers, so the stop reply for the
+        # trap carries the frame record that the frame pointer points at.
+        expedited_registers = self.extract_registers_from_stop_notification(
+            trap_key_vals_text
+        )
+        reg_infos = self.gather_register_infos()
+        fp_info = self.find_generic_register_with_name(reg_infos, "fp")
+        self.assertIsNotNone(fp_info)
+        fp_hex = expedited_registers.get(fp_info["lldb_register_index"])
+        self.assertIsNotNone(fp_hex)
+
+        self.reset_test_sequence()
+        self.add_process_info_collection_packets()
+        context = self.expect_gdbremote_sequence()
+        self.assertIsNotNone(context)
+        process_info = self.parse_process_info_response(context)
+        endian = process_info.get("endian")
+        self.assertIsNotNone(endian)
+        fp = lldbgdbserverutils.unpack_register_hex_unsigned(endian, fp_hex)
+
+        memory = re.findall(
+            r"memory:0x([0-9a-fA-F]+)=([0-9a-fA-F]+);", trap_key_vals_text
+        )
+        self.assertGreater(len(memory), 0)
+        self.assertEqual(int(memory[0][0], 16), fp)
+        # Each record is the saved frame pointer and the return address, each
+        # as wide as the frame pointer register.
+        for addr, data in memory:
+            self.assertEqual(len(data), 2 * len(fp_hex))
+        # Records are listed from the innermost frame outwards.
+        addrs = [int(addr, 16) for addr, _ in memory]
+        self.assertEqual(addrs, sorted(addrs))
+
+        # Single step stops do not expedite memory.
+        self.assertIn("reason:trace;", step_key_vals_text)
+        self.assertNotIn("memory:", step_key_vals_text)
@@ -0,0 +1,98 @@
+//===- DenseMapBM.cpp - DenseMap benchmark --------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Measures DenseMap with pointer keys, the most common use in the optimizer
+// (Value *, const SCEV *, SDNode *, ...). Keys point into separately allocated
+// objects, and are looked up in random order, so that the cost of probing
+// rather than locality of the test dominates once the table outgrows the
+// caches.
+//
+//===----------------------------------------------------------------------===//
+
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace llvm;
+
+namespace {
+struct Object {
+  uint64_t Payload[4];
+};
+
+/// A set of distinct pointer keys, in random order.
+class Keys {
+public:
+  explicit Keys(int64_t N) {
+    for (int64_t I = 0; I < N; ++I)
+      Objects.push_back(std::make_unique<Object>());
+    std::mt19937_64 RNG(N);
+    std::shuffle(Objects.begin(), Objects.end(), RNG);
+    for (const auto &O : Objects)
+      Ptrs.push_back(O.get());
+  }
+
+  const std::vector<const Object *> &get() const { return Ptrs; }
+
+private:
+  std::vector<std::unique_ptr<Object>> Objects;
+  std::vector<const Object *> Ptrs;
+};
+} // namespace
+
+static DenseMap<const Object *, unsigned> buildMap(ArrayRef<const Object *> K) {
+  DenseMap<const Object *, unsigned> Map;
+  for (unsigned I = 0, E = K.size(); I != E; ++I)
+    Map[K[I]] = I;
+  return Map;
+}
+
+static void BM_DenseMapPointerInsert(benchmark::State &State) {
+  Keys K(State.range(0));
+  for (auto _ : State)
+    benchmark::DoNotOptimize(buildMap(K.get()));
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void BM_DenseMapPointerLookupHit(benchmark::State &State) {
+  Keys K(State.range(0));
+  auto Map = buildMap(K.get());
+  std::vector<const Object *> Order = K.get();
+  std::shuffle(Order.begin(), Order.end(), std::mt19937_64(1));
+  for (auto _ : State)
+    for (const Object *O : Order)
+      benchmark::DoNotOptimize(Map.find(O));
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void BM_DenseMapPointerLookupMiss(benchmark::State &State) {
+  // Build the map from half the keys and look up the other half, which are
+  // interleaved with them in memory.
+  Keys K(State.range(0) * 2);
+  ArrayRef<const Object *> All = K.get();
+  auto Map = buildMap(All.take_front(State.range(0)));
+  ArrayRef<const Object *> Absent = All.drop_front(State.range(0));
+  for (auto _ : State)
+    for (const Object *O : Absent)
+      benchmark::DoNotOptimize(Map.find(O));
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+BENCHMARK(BM_DenseMapPointerInsert)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK(BM_DenseMapPointerLookupHit)
+    ->RangeMultiplier(16)
+    ->Range(256, 1 << 20);
+BENCHMARK(BM_DenseMapPointerLookupMiss)
+    ->RangeMultiplier(16)
+    ->Range(256, 1 << 20);
+
+BENCHMARK_MAIN();
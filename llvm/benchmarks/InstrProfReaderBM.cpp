@@ -0,0 +1,105 @@
+//===- InstrProfReaderBM.cpp - Indexed profile benchmarks -----------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Measures writing, reading, looking up and merging indexed instrumentation
+// profiles built from synthetic functions.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ProfileData/InstrProfReader.h"
+#include "llvm/ProfileData/InstrProfWriter.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+// Shape of the synthetic profile: a fixed number of counters per function,
+// with counts that vary enough to keep the value encoding non-trivial.
+static constexpr unsigned NumCountersPerFunction = 8;
+
+static std::string getFunctionName(int64_t I) {
+  return "_ZN4llvm9benchmark8functionEv" + std::to_string(I);
+}
+
+static uint64_t getFunctionHash(int64_t I) { return 0x1234 + I; }
+
+static std::unique_ptr<MemoryBuffer> createIndexedProfile(int64_t NumFuncs) {
+  InstrProfWriter Writer;
+  auto Warn = [](Error E) { consumeError(std::move(E)); };
+  for (int64_t I = 0; I < NumFuncs; ++I) {
+    std::vector<uint64_t> Counts;
+    for (unsigned J = 0; J < NumCountersPerFunction; ++J)
+      Counts.push_back((I * 31 + J * 7) % 1000 + 1);
+    Writer.addRecord({getFunctionName(I), getFunctionHash(I), Counts}, Warn);
+  }
+  return Writer.writeBuffer();
+}
+
+static std::unique_ptr<IndexedInstrProfReader>
+createReader(const MemoryBuffer &Profile) {
+  return cantFail(IndexedInstrProfReader::create(
+      MemoryBuffer::getMemBuffer(Profile.getMemBufferRef(),
+                                 /*RequiresNullTerminator=*/false)));
+}
+
+static void BM_InstrProfWrite(benchmark::State &State) {
+  for (auto _ : State)
+    benchmark::DoNotOptimize(createIndexedProfile(State.range(0)));
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void BM_InstrProfIndexedReadAll(benchmark::State &State) {
+  std::unique_ptr<MemoryBuffer> Profile = createIndexedProfile(State.range(0));
+  for (auto _ : State) {
+    auto Reader = createReader(*Profile);
+    for (const NamedInstrProfRecord &Record : *Reader)
+      benchmark::DoNotOptimize(Record.Counts.data());
+  }
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+  State.SetBytesProcessed(State.iterations() * Profile->getBufferSize());
+}
+
+static void BM_InstrProfIndexedLookup(benchmark::State &State) {
+  std::unique_ptr<MemoryBuffer> Profile = createIndexedProfile(State.range(0));
+  std::vector<std::string> Names;
+  for (int64_t I = 0; I < State.range(0); ++I)
+    Names.push_back(getFunctionName(I));
+  auto Reader = createReader(*Profile);
+  for (auto _ : State) {
+    for (int64_t I = 0; I < State.range(0); ++I)
+      benchmark::DoNotOptimize(
+          cantFail(Reader->getInstrProfRecord(Names[I], getFunctionHash(I))));
+  }
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void BM_InstrProfMergeWriters(benchmark::State &State) {
+  std::unique_ptr<MemoryBuffer> Profile = createIndexedProfile(State.range(0));
+  auto Warn = [](Error E) { consumeError(std::move(E)); };
+  for (auto _ : State) {
+    InstrProfWriter Writer;
+    for (unsigned Input = 0; Input < 2; ++Input) {
+      auto Reader = createReader(*Profile);
+      for (NamedInstrProfRecord &Record : *Reader)
+        Writer.addRecord(std::move(Record), Warn);
+    }
+    benchmark::DoNotOptimize(Writer.writeBuffer());
+  }
+  State.SetItemsProcessed(State.iterations() * State.range(0) * 2);
+}
+
+BENCHMARK(BM_InstrProfWrite)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_InstrProfIndexedReadAll)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_InstrProfIndexedLookup)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_InstrProfMergeWriters)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
@@ -21,6 +21,12 @@
 ///
 /// NOTE: Statistics *must* be declared as global variables.
 ///
+/// In builds with assertions disabled, STATISTIC expands to a no-op unless
+/// LLVM is configured with LLVM_FORCE_ENABLE_STATS. A counter that is cheap
+/// enough to ship in every build can use ALWAYS_ENABLED_STATISTIC instead; it
+/// costs one relaxed atomic add per update. Either kind is reported per
+/// DEBUG_TYPE by -stats, or as JSON by -stats-json.
+///
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_ADT_STATISTIC_H
@@ -17,6 +17,7 @@
 #include "llvm/Analysis/BlockFrequencyInfo.h"
 #include "llvm/IR/DiagnosticInfo.h"
 #include "llvm/IR/Function.h"
+#include "llvm/IR/LLVMRemarkStreamer.h"
 #include "llvm/IR/PassManager.h"
 #include "llvm/Pass.h"
 #include "llvm/Support/Compiler.h"
@@ -105,7 +106,10 @@ public:
     return allowExtraAnalysis(F.getContext(), PassName);
   }
   static bool allowExtraAnalysis(LLVMContext &Ctx, StringRef PassName) {
-    return Ctx.getLLVMRemarkStreamer() ||
+    // Remarks of passes that are filtered out of the optimization record are
+    // dropped anyway, so they are not worth the extra analysis.
+    LLVMRemarkStreamer *RS = Ctx.getLLVMRemarkStreamer();
+    return (RS && RS->matchesFilter(PassName)) ||
            Ctx.getDiagHandlerPtr()->isAnyRemarkEnabled(PassName);
   }
 
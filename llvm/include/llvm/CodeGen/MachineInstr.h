@@ -129,7 +129,10 @@ private:
   const MCInstrDesc *MCID;              // Instruction descriptor.
   MachineBasicBlock *Parent = nullptr;  // Pointer to the owning basic block.
 
-  // Operands are allocated by an ArrayRecycler.
+  // Operands are allocated by an ArrayRecycler. They must stay full
+  // MachineOperand objects: register operands are threaded into the
+  // MachineRegisterInfo use-def lists by address, and getOperand() and
+  // operands() hand out references into this array.
   MachineOperand *Operands = nullptr;   // Pointer to the first operand.
 
 #define LLVM_MI_NUMOPERANDS_BITS 24
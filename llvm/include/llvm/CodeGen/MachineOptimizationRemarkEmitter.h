@@ -19,6 +19,7 @@
 #include "llvm/CodeGen/MachinePassManager.h"
 #include "llvm/IR/DiagnosticInfo.h"
 #include "llvm/IR/Function.h"
+#include "llvm/IR/LLVMRemarkStreamer.h"
 #include "llvm/Support/Compiler.h"
 #include <optional>
 
@@ -175,10 +176,10 @@ public:
   /// (1) to filter trivial false positives or (2) to provide more context so
   /// that non-trivial false positives can be quickly detected by the user.
   bool allowExtraAnalysis(StringRef PassName) const {
-    return (
-        MF.getFunction().getContext().getLLVMRemarkStreamer() ||
-        MF.getFunction().getContext().getDiagHandlerPtr()->isAnyRemarkEnabled(
-            PassName));
+    LLVMContext &Ctx = MF.getFunction().getContext();
+    LLVMRemarkStreamer *RS = Ctx.getLLVMRemarkStreamer();
+    return (RS && RS->matchesFilter(PassName)) ||
+           Ctx.getDiagHandlerPtr()->isAnyRemarkEnabled(PassName);
   }
 
   /// Take a lambda that returns a remark which will be emitted.  Second
@@ -270,6 +270,8 @@ class SwingSchedulerDAG : public ScheduleDAGInstrs {
   unsigned MAX_II = 0;
   /// Set to true if a valid pipelined schedule is found for the loop.
   bool Scheduled = false;
+  /// Set to true if the II search ran out of -pipeliner-ii-search-budget.
+  bool IISearchBudgetExhausted = false;
   MachineLoop &Loop;
   LiveIntervals &LIS;
   const RegisterClassInfo &RegClassInfo;
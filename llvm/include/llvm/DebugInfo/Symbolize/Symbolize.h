@@ -48,6 +48,14 @@ using FileLineInfoKind = DILineInfoSpecifier::FileLineInfoKind;
 
 class CachedBinary;
 
+/// Symbolizes addresses in binaries, caching the parsed binaries and their
+/// debug info between requests.
+///
+/// The caches are not synchronized, so an LLVMSymbolizer must not be used
+/// from several threads at once; a server that wants concurrency should
+/// partition requests by binary and give each thread its own symbolizer,
+/// which also keeps each thread's DWARF units warm. Options::MaxCacheSize
+/// bounds the memory held by cached binaries.
 class LLVMSymbolizer {
 public:
   struct Options {
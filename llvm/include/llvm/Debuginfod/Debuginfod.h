@@ -99,6 +99,13 @@ Expected<std::string> getCachedOrDownloadArtifact(
 
 class ThreadPoolInterface;
 
+/// Fetches the debug binaries for all of \p IDs concurrently on \p Pool, so
+/// that later getCachedOrDownloadDebuginfo calls for them are served from the
+/// default local cache. Lookup failures are ignored; the later calls report
+/// them. Returns the number of IDs whose debug binary is available locally.
+size_t prefetchDebuginfo(ArrayRef<object::BuildID> IDs,
+                         ThreadPoolInterface &Pool);
+
 struct DebuginfodLogEntry {
   std::string Message;
   DebuginfodLogEntry() = default;
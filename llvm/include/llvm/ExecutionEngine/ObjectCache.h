@@ -21,6 +21,13 @@ class Module;
 /// This is the base ObjectCache type which can be provided to an
 /// ExecutionEngine for the purpose of avoiding compilation for Modules that
 /// have already been compiled and an object file is available.
+///
+/// Implementations are responsible for keying objects; a key must cover the
+/// module contents as well as the target triple, CPU, features and codegen
+/// options. An on-disk cache can be built on localCache() and pruneCache()
+/// from llvm/Support/Caching.h and CachePruning.h, and getObject can return
+/// the result of MemoryBuffer::getFile, which maps large objects rather than
+/// copying them, since ObjectLinkingLayer only reads from the buffer.
 class LLVM_ABI ObjectCache {
   virtual void anchor();
 
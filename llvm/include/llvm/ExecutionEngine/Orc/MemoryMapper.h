@@ -122,6 +122,12 @@ private:
   size_t PageSize;
 };
 
+/// Maps memory that is shared between the controller and an out-of-process
+/// executor, so that the linker writes code and data in place rather than
+/// sending it over the wire. Used with MapperJITLinkMemoryManager, whose slab
+/// reservation means a single reserve call typically covers many graphs; each
+/// graph then costs one initialize call, carrying all of its segments and
+/// finalize actions, and deallocations are deinitialized in batches.
 class LLVM_ABI SharedMemoryMapper final : public MemoryMapper {
 public:
   struct SymbolAddrs {
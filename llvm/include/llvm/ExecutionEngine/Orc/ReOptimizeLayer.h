@@ -22,6 +22,8 @@
 #include "llvm/Transforms/Utils/BasicBlockUtils.h"
 #include "llvm/Transforms/Utils/Cloning.h"
 
+#include <atomic>
+
 namespace llvm {
 namespace orc {
 
@@ -60,6 +62,17 @@ public:
     this->ProfilerFunc = std::move(ProfilerFunc);
   }
 
+  /// Set the number of calls after which reoptimizeIfCallFrequent requests
+  /// reoptimization of a materialization unit. Only affects units emitted
+  /// after the call.
+  void setCallCountThreshold(uint64_t Threshold) {
+    ReoptimizeThreshold.store(Threshold, std::memory_order_relaxed);
+  }
+
+  uint64_t getCallCountThreshold() const {
+    return ReoptimizeThreshold.load(std::memory_order_relaxed);
+  }
+
   /// Registers reoptimize runtime dispatch handlers to given PlatformJD. The
   /// reoptimization request will not be handled if dispatch handler is not
   /// registered by using this function.
@@ -70,10 +83,11 @@ public:
   void emit(std::unique_ptr<MaterializationResponsibility> R,
             ThreadSafeModule TSM) override;
 
+  /// Default for getCallCountThreshold().
   static const uint64_t CallCountThreshold = 10;
 
   /// Basic AddProfilerFunc that reoptimizes the function when the call count
-  /// exceeds CallCountThreshold.
+  /// exceeds the parent's getCallCountThreshold().
   static Error reoptimizeIfCallFrequent(ReOptimizeLayer &Parent,
                                         ReOptMaterializationUnitID MUID,
                                         unsigned CurVersion,
@@ -169,6 +183,8 @@ private:
 
   ReOptimizeFunc ReOptFunc;
   AddProfilerFunc ProfilerFunc;
+  // Set by clients and read by concurrent materializations.
+  std::atomic<uint64_t> ReoptimizeThreshold = CallCountThreshold;
 
   std::mutex Mutex;
   std::map<ReOptMaterializationUnitID, ReOptMaterializationUnitState> MUStates;
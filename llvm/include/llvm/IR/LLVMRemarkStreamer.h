@@ -43,6 +43,9 @@ public:
   LLVMRemarkStreamer(remarks::RemarkStreamer &RS) : RS(RS) {}
   /// Emit a diagnostic through the streamer.
   LLVM_ABI void emit(const DiagnosticInfoOptimizationBase &Diag);
+  /// Whether remarks from \p PassName pass the filter that the output was set
+  /// up with, and so end up in the output.
+  LLVM_ABI bool matchesFilter(StringRef PassName) const;
 };
 
 template <typename ThisError>
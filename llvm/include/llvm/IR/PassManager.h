@@ -826,6 +826,15 @@ using ModuleAnalysisManagerFunctionProxy =
 /// Note that although function passes can access module analyses, module
 /// analyses are not invalidated while the function passes are running, so they
 /// may be stale.  Function analyses will not be stale.
+///
+/// Functions are visited one at a time, in module order. The rules above would
+/// permit running them concurrently, but nothing else does yet: creating a
+/// constant, type or metadata node mutates the uniquing tables of the shared
+/// LLVMContext, every new use of a global or constant edits its shared use
+/// list, and the FunctionAnalysisManager's result cache and the pass
+/// instrumentation callbacks are unsynchronized. Clients that need parallelism
+/// today split the module and give each part its own context, as the LTO and
+/// split-codegen paths do.
 class ModuleToFunctionPassAdaptor
     : public PassInfoMixin<ModuleToFunctionPassAdaptor> {
 public:
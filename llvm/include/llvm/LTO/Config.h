@@ -68,6 +68,13 @@ struct Config {
   /// Disable entirely the optimizer, including importing for ThinLTO
   bool CodeGenOnly = false;
 
+  /// With parallel code generation, run only the passes that need the whole
+  /// program on the merged regular LTO module, then run the rest of the
+  /// optimization pipeline on each code generation partition in parallel. This
+  /// gives up inlining and other interprocedural optimization across
+  /// partitions.
+  bool ParallelRegularLTOOpt = false;
+
   /// Run PGO context sensitive IR instrumentation.
   bool RunCSIRInstr = false;
 
@@ -174,6 +181,11 @@ struct Config {
   /// Statistics output file path.
   std::string StatsFile;
 
+  /// If non-empty, the thin link writes a JSON description of the ThinLTO
+  /// backend jobs to this file: for each job, its bitcode inputs, cache key
+  /// and predicted cost.
+  std::string ThinLTOJobGraphFile;
+
   /// Specific thinLTO modules to compile.
   std::vector<std::string> ThinLTOModulesToCompile;
 
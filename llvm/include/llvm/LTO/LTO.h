@@ -104,6 +104,11 @@ setupStatsFile(StringRef StatsFilename);
 /// ordered indices to elements in the input array.
 LLVM_ABI std::vector<int> generateModulesOrdering(ArrayRef<BitcodeModule *> R);
 
+/// Like above, but orders by the predicted backend cost of each module, with
+/// \p Costs parallel to \p R. Modules of equal cost are ordered by size.
+LLVM_ABI std::vector<int> generateModulesOrdering(ArrayRef<BitcodeModule *> R,
+                                                  ArrayRef<uint64_t> Costs);
+
 /// Updates MemProf attributes (and metadata) based on whether the index
 /// has recorded that we are linking with allocation libraries containing
 /// the necessary APIs for downstream transformations.
@@ -475,8 +480,8 @@ private:
   // internalization decisions either directly to the module (for regular LTO)
   // or to the combined index (for ThinLTO).
   struct GlobalResolution {
-    /// The unmangled name of the global.
-    std::string IRName;
+    /// The unmangled name of the global, interned in IRNameSaver.
+    StringRef IRName;
 
     /// Keep track if the symbol is visible outside of a module with a summary
     /// (i.e. in either a regular object or a regular LTO module without a
@@ -530,6 +535,11 @@ private:
   // Symbol saver for global resolution map.
   std::unique_ptr<llvm::StringSaver> GlobalResolutionSymbolSaver;
 
+  // Interns the IR names of GlobalResolutions, which repeat across the modules
+  // that reference the same symbol.
+  std::unique_ptr<llvm::BumpPtrAllocator> IRNameAlloc;
+  std::unique_ptr<llvm::UniqueStringSaver> IRNameSaver;
+
   // Global mapping from mangled symbol names to resolutions.
   // Make this an unique_ptr to guard against accessing after it has been reset
   // (to reduce memory after we're done with it).
@@ -70,6 +70,11 @@ private:
 
   SectionListType Sections;
 
+  /// The sections with at least one fragment that relaxFragment can change,
+  /// computed at the start of layout. The others only need to be laid out
+  /// once.
+  SectionListType RelaxableSections;
+
   SmallVector<const MCSymbol *, 0> Symbols;
 
   mutable SmallVector<std::pair<SMLoc, std::string>, 0> PendingErrors;
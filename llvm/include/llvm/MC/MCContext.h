@@ -81,6 +81,11 @@ struct WasmSignature;
 /// Context object for machine code objects.  This class owns all of the
 /// sections that it creates.
 ///
+/// An MCContext is not thread-safe: symbol and section uniquing, fragment
+/// allocation and the temporary label counters all assume a single user.
+/// Parallel code generation gives each thread its own module, TargetMachine
+/// and MCContext (see LTO's parallel codegen and llc -codegen-partitions)
+/// and combines the resulting objects afterwards.
 class MCContext {
 public:
   using SymbolTable = StringMap<MCSymbolTableValue, BumpPtrAllocator &>;
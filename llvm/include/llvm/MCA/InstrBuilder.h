@@ -107,6 +107,12 @@ public:
   void clear() {
     Descriptors.clear();
     VariantDescriptors.clear();
+    resetWarnings();
+  }
+
+  /// Warn again about calls and returns found in the next sequence of
+  /// instructions. Unlike clear(), this keeps the cached descriptors.
+  void resetWarnings() {
     FirstCallInst = true;
     FirstReturnInst = true;
   }
@@ -75,6 +75,14 @@ enum PGOCtxProfileBlockIDs {
 /// like value profiling - which would appear as additional records. For
 /// example, value profiling would produce a new record with a new record ID,
 /// containing the profiled values (much like the counters)
+///
+/// Size: unless IncludeEmpty is set, a context that was never entered is not
+/// written, and neither is anything under it. So an unexercised part of a
+/// large tree costs nothing in the output. Identical subtrees are not shared,
+/// though: two contexts of the same callee almost never have equal counters,
+/// and keeping them apart is what makes the profile contextual. Each root
+/// gets its own ContextRootBlockID block, which lets a reader skip a whole
+/// root without decoding it.
 class LLVM_ABI PGOCtxProfileWriter final : public ctx_profile::ProfileWriter {
   enum class EmptyContextCriteria { None, EntryIsZero, AllAreZero };
 
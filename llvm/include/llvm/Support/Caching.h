@@ -8,7 +8,8 @@
 //
 // This file defines the CachedFileStream and the localCache function, which
 // simplifies caching files on the local filesystem in a directory whose
-// contents are managed by a CachePruningPolicy.
+// contents are managed by a CachePruningPolicy. The remoteCache function layers
+// a shared content-addressed store on top of a local cache.
 //
 //===----------------------------------------------------------------------===//
 
@@ -17,6 +18,7 @@
 
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/Error.h"
+#include <memory>
 
 namespace llvm {
 
@@ -66,6 +68,11 @@ using AddStreamFn = std::function<Expected<std::unique_ptr<CachedFileStream>>(
 using FileCacheFunction = std::function<Expected<AddStreamFn>(
     unsigned Task, StringRef Key, const Twine &ModuleName)>;
 
+/// This is a callable that starts fetching the entry for \p Key in the
+/// background, so that a later lookup of the same key does not wait for it.
+/// It must be thread safe and must not block.
+using FileCachePrefetchFunction = std::function<void(StringRef Key)>;
+
 /// This type represents a file cache system that manages caching of files.
 /// It encapsulates a caching function and the directory path where the cache is
 /// stored. To request an item from the cache, pass a unique string as the Key.
@@ -82,9 +89,15 @@ using FileCacheFunction = std::function<Expected<AddStreamFn>(
 ///   ProduceContent(AddStream);
 ///
 /// CacheDirectoryPath stores the directory path where cached files are kept.
+///
+/// Caches whose lookups may be slow, e.g. because they go over the network, can
+/// also be given a prefetch function. Clients that know keys ahead of time
+/// should pass them to prefetch() as early as possible.
 struct FileCache {
-  FileCache(FileCacheFunction CacheFn, const std::string &DirectoryPath)
-      : CacheFunction(std::move(CacheFn)), CacheDirectoryPath(DirectoryPath) {}
+  FileCache(FileCacheFunction CacheFn, const std::string &DirectoryPath,
+            FileCachePrefetchFunction PrefetchFn = nullptr)
+      : CacheFunction(std::move(CacheFn)), CacheDirectoryPath(DirectoryPath),
+        PrefetchFunction(std::move(PrefetchFn)) {}
   FileCache() = default;
 
   Expected<AddStreamFn> operator()(unsigned Task, StringRef Key,
@@ -92,14 +105,20 @@ struct FileCache {
     assert(isValid() && "Invalid cache function");
     return CacheFunction(Task, Key, ModuleName);
   }
+  void prefetch(StringRef Key) {
+    if (PrefetchFunction)
+      PrefetchFunction(Key);
+  }
   const std::string &getCacheDirectoryPath() const {
     return CacheDirectoryPath;
   }
   bool isValid() const { return static_cast<bool>(CacheFunction); }
+  bool canPrefetch() const { return static_cast<bool>(PrefetchFunction); }
 
 private:
   FileCacheFunction CacheFunction = nullptr;
   std::string CacheDirectoryPath;
+  FileCachePrefetchFunction PrefetchFunction = nullptr;
 };
 
 /// This type defines the callback to add a pre-existing file (e.g. in a cache).
@@ -119,6 +138,34 @@ LLVM_ABI Expected<FileCache> localCache(
     const Twine &CacheDirectoryPathRef,
     AddBufferFn AddBuffer = [](size_t Task, const Twine &ModuleName,
                                std::unique_ptr<MemoryBuffer> MB) {});
+
+/// A content-addressed blob store shared between machines, such as an HTTP or
+/// gRPC service, that remoteCache() reads through to and writes back to.
+/// Implementations must be thread safe.
+class LLVM_ABI RemoteCacheStore {
+public:
+  virtual ~RemoteCacheStore();
+
+  /// Returns the blob stored under \p Key, or nullptr if there is none.
+  virtual Expected<std::unique_ptr<MemoryBuffer>> get(StringRef Key) = 0;
+
+  /// Stores \p Data under \p Key.
+  virtual Error put(StringRef Key, StringRef Data) = 0;
+};
+
+/// Create a cache that is backed by a local file system cache, as created by
+/// localCache(), and by \p Store. Lookups that miss the local cache are read
+/// through from the store, and the fetched entry is added to the local cache.
+/// Entries produced on a miss of both are written back to the store in the
+/// background. Store errors are treated as misses so that an unavailable store
+/// does not fail the build. The returned cache supports prefetch(), which
+/// fetches from the store on up to \p MaxFetchThreads background threads.
+LLVM_ABI Expected<FileCache> remoteCache(
+    const Twine &CacheNameRef, const Twine &TempFilePrefixRef,
+    const Twine &CacheDirectoryPathRef, std::shared_ptr<RemoteCacheStore> Store,
+    unsigned MaxFetchThreads = 8,
+    AddBufferFn AddBuffer = [](size_t Task, const Twine &ModuleName,
+                               std::unique_ptr<MemoryBuffer> MB) {});
 } // namespace llvm
 
 #endif
@@ -0,0 +1,106 @@
+//===- llvm/Support/Jobserver.h - Jobserver Client --------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares a client for the GNU make jobserver protocol, which is
+// also implemented by ninja. A build tool running with "-jN" hands out N-1
+// tokens through a pipe or a named fifo; every process it starts implicitly
+// owns one more. A client that wants to run more than one job at a time reads
+// a token before starting each extra job and writes it back when that job is
+// done, so the whole build stays within N concurrent jobs.
+//
+// See https://www.gnu.org/software/make/manual/html_node/Job-Slots.html.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_JOBSERVER_H
+#define LLVM_SUPPORT_JOBSERVER_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Compiler.h"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+namespace llvm {
+
+/// A job slot handed out by a JobserverClient. A slot is either the implicit
+/// slot the process owns, or an explicit token read from the jobserver that
+/// has to be written back. Slots are move-only, and a valid slot must be given
+/// back with JobserverClient::release().
+class JobSlot {
+public:
+  /// Creates an invalid slot.
+  JobSlot() = default;
+
+  JobSlot(JobSlot &&Other) : Value(Other.Value) {
+    Other.Value = InvalidValue;
+  }
+  JobSlot &operator=(JobSlot &&Other) {
+    if (this != &Other) {
+      Value = Other.Value;
+      Other.Value = InvalidValue;
+    }
+    return *this;
+  }
+  JobSlot(const JobSlot &) = delete;
+  JobSlot &operator=(const JobSlot &) = delete;
+
+  static JobSlot createImplicit() { return JobSlot(ImplicitValue); }
+  static JobSlot createExplicit(uint8_t Token) { return JobSlot(Token); }
+
+  bool isValid() const { return Value != InvalidValue; }
+  bool isImplicit() const { return Value == ImplicitValue; }
+  bool isExplicit() const { return isValid() && !isImplicit(); }
+
+  /// Returns the token byte read from the jobserver.
+  uint8_t getExplicitToken() const {
+    assert(isExplicit() && "not an explicit job slot");
+    return static_cast<uint8_t>(Value);
+  }
+
+private:
+  static constexpr int16_t InvalidValue = -1;
+  static constexpr int16_t ImplicitValue = -2;
+
+  explicit JobSlot(int16_t Value) : Value(Value) {}
+
+  int16_t Value = InvalidValue;
+};
+
+/// A client of a build tool's jobserver.
+class LLVM_ABI JobserverClient {
+public:
+  virtual ~JobserverClient();
+
+  /// Tries to get a job slot without blocking. The implicit slot is handed
+  /// out first; once it is taken, a token is read from the jobserver. Returns
+  /// an invalid slot if none is available right now.
+  virtual JobSlot tryAcquire() = 0;
+
+  /// Gives back a slot obtained from tryAcquire(). Explicit tokens are written
+  /// back to the jobserver.
+  virtual void release(JobSlot Slot) = 0;
+
+  /// Returns the "-j" job count the build tool was started with, or 0 if it
+  /// did not say.
+  virtual unsigned getNumJobs() const = 0;
+
+  /// Creates a client for the jobserver described by \p MakeFlags, which has
+  /// the format of the MAKEFLAGS environment variable. Returns nullptr if it
+  /// names no jobserver, or one this process cannot use.
+  static std::unique_ptr<JobserverClient> create(StringRef MakeFlags);
+
+  /// Returns the process-wide client for the jobserver named by MAKEFLAGS, or
+  /// nullptr if there is none.
+  static JobserverClient *getInstance();
+};
+
+} // end namespace llvm
+
+#endif // LLVM_SUPPORT_JOBSERVER_H
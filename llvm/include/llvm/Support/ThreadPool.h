@@ -16,6 +16,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Config/llvm-config.h"
 #include "llvm/Support/Compiler.h"
+#include "llvm/Support/Jobserver.h"
 #include "llvm/Support/RWMutex.h"
 #include "llvm/Support/Threading.h"
 #include "llvm/Support/thread.h"
@@ -173,6 +174,8 @@ private:
       // Don't allow enqueueing after disabling the pool
       assert(EnableFlag && "Queuing a thread during ThreadPool destruction");
       Tasks.emplace_back(std::make_pair(std::move(Task), Group));
+      if (Group != nullptr)
+        ++PendingGroups[Group]; // Increment or set to 1 if new item
       requestedThreads = ActiveThreads + Tasks.size();
     }
     QueueCondition.notify_one();
@@ -185,6 +188,10 @@ private:
 
   void processTasks(ThreadPoolTaskGroup *WaitingForGroup);
 
+  /// Wait for tasks to be queued, then for a slot from \p Jobserver to run
+  /// them. Returns an invalid slot if the pool is destroyed meanwhile.
+  JobSlot acquireJobSlot(JobserverClient &Jobserver);
+
   /// Threads in flight
   std::vector<llvm::thread> Threads;
   /// Lock protecting access to the Threads vector.
@@ -202,14 +209,20 @@ private:
 
   /// Keep track of the number of thread actually busy
   unsigned ActiveThreads = 0;
-  /// Number of threads active for tasks in the given group (only non-zero).
-  DenseMap<ThreadPoolTaskGroup *, unsigned> ActiveGroups;
+  /// Number of tasks in the given group that are either queued or running
+  /// (only non-zero). This lets a group's completion be checked without
+  /// scanning the whole Tasks queue.
+  DenseMap<ThreadPoolTaskGroup *, unsigned> PendingGroups;
 
   /// Signal for the destruction of the pool, asking thread to exit.
   bool EnableFlag = true;
 
   const ThreadPoolStrategy Strategy;
 
+  /// The jobserver to take job slots from, if Strategy.UseJobserver is set and
+  /// there is one.
+  JobserverClient *TheJobserver = nullptr;
+
   /// Maximum number of threads to potentially grow this pool to.
   const unsigned MaxThreadCount;
 };
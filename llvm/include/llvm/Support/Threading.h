@@ -128,6 +128,11 @@ constexpr bool llvm_is_multithreaded() { return LLVM_ENABLE_THREADS; }
     // threads, or hardware cores.
     bool Limit = false;
 
+    // If set, and this process was started by a build tool that runs a
+    // jobserver (see Support/Jobserver.h), a thread only runs tasks while it
+    // holds one of the build's job slots.
+    bool UseJobserver = false;
+
     /// Retrieves the max available threads for the current strategy. This
     /// accounts for affinity masks and takes advantage of all CPU sockets.
     LLVM_ABI unsigned compute_thread_count() const;
@@ -200,6 +205,19 @@ constexpr bool llvm_is_multithreaded() { return LLVM_ENABLE_THREADS; }
     return hardware_concurrency();
   }
 
+  /// Returns a thread strategy like hardware_concurrency(), that additionally
+  /// shares the job slots of the build tool which started this process, if it
+  /// runs a jobserver. This keeps a parallel link or ThinLTO backend from
+  /// oversubscribing the machine in a "make -jN" build. Tasks run with this
+  /// strategy must not block on other tasks of the same pool other than through
+  /// ThreadPoolTaskGroup::wait(), as there may be a single slot to run them.
+  inline ThreadPoolStrategy jobserver_concurrency(unsigned ThreadCount = 0) {
+    ThreadPoolStrategy S;
+    S.ThreadsRequested = ThreadCount;
+    S.UseJobserver = true;
+    return S;
+  }
+
   /// Returns an optimal thread strategy to execute specified amount of tasks.
   /// This strategy should prevent us from creating too many threads if we
   /// occasionaly have an unexpectedly small amount of tasks.
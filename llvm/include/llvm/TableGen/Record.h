@@ -2072,6 +2072,10 @@ private:
 
   std::string InputFilename;
   RecordMap Classes, Defs;
+  /// Results of getAllDerivedDefinitions(StringRef), filled on first use.
+  /// Neither this nor the Init uniquer in Impl, which backends also reach by
+  /// creating Inits, is synchronized, so backends sharing a RecordKeeper must
+  /// not run concurrently.
   mutable std::map<std::string, std::vector<const Record *>> Cache;
   GlobalMap ExtraGlobals;
 
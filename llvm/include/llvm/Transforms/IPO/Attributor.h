@@ -1482,6 +1482,10 @@ struct AttributorConfig {
   /// Maximum number of iterations to run until fixpoint.
   std::optional<unsigned> MaxFixpointIterations;
 
+  /// Wall-clock budget, in milliseconds, for the fixpoint iteration; 0 means
+  /// unlimited. Checked between iterations.
+  std::optional<unsigned> FixpointTimeBudgetMS;
+
   /// A callback function that returns an ORE object from a Function pointer.
   ///{
   using OptimizationRemarkGetter =
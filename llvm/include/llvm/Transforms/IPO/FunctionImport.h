@@ -365,6 +365,21 @@ LLVM_ABI void ComputeCrossModuleImport(
     FunctionImporter::ImportListsTy &ImportLists,
     DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists);
 
+/// Compute the export lists implied by \p ImportLists, which must have been
+/// computed by ComputeCrossModuleImport() from an equivalent index. This lets
+/// clients that saved the import lists of an earlier link skip recomputing
+/// them.
+LLVM_ABI void ComputeCrossModuleExports(
+    const ModuleSummaryIndex &Index,
+    const DenseMap<StringRef, GVSummaryMapTy> &ModuleToDefinedGVSummaries,
+    const FunctionImporter::ImportListsTy &ImportLists,
+    DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists);
+
+/// Returns a string that identifies the options affecting the import decisions
+/// of ComputeCrossModuleImport(), or an empty string if the decisions depend
+/// on external files and must not be reused across links.
+LLVM_ABI std::string getCrossModuleImportOptionsKey();
+
 /// PrevailingType enum used as a return type of callback passed
 /// to computeDeadSymbolsAndUpdateIndirectCalls. Yes and No values used when
 /// status explicitly set by symbols resolution, otherwise status is Unknown.
@@ -74,7 +74,12 @@ void FunctionPropertiesInfo::updateForBB(const BasicBlock &BB,
   BasicBlockCount += Direction;
   BlocksReachedFromConditionalInstruction +=
       (Direction * getNumBlocksFromCond(BB));
+  // Count the instructions in the same walk rather than through
+  // BB.sizeWithoutDebug(), which goes over the block again with a filter.
+  int64_t InstructionCount = 0;
   for (const auto &I : BB) {
+    if (!isa<DbgInfoIntrinsic>(I) && !isa<PseudoProbeInst>(I))
+      ++InstructionCount;
     if (auto *CS = dyn_cast<CallBase>(&I)) {
       const auto *Callee = CS->getCalledFunction();
       if (Callee && !Callee->isIntrinsic() && !Callee->isDeclaration())
@@ -86,7 +91,7 @@ void FunctionPropertiesInfo::updateForBB(const BasicBlock &BB,
       StoreInstCount += Direction;
     }
   }
-  TotalInstructionCount += Direction * BB.sizeWithoutDebug();
+  TotalInstructionCount += Direction * InstructionCount;
 
   if (EnableDetailedFunctionProperties) {
     unsigned SuccessorCount = succ_size(&BB);
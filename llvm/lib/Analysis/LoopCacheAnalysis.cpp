@@ -659,13 +659,15 @@ bool CacheCost::populateReferenceGroups(ReferenceGroupsTy &RefGroups) const {
        // when in actuality, depending on the array size, the first example
        // should have a cost closer to 2x the second due to the two cache
        // access per iteration from opposite ends of the array
-        std::optional<bool> HasTemporalReuse =
-            R->hasTemporalReuse(Representative, *TRT, *InnerMostLoop, DI, AA);
-        std::optional<bool> HasSpacialReuse =
-            R->hasSpacialReuse(Representative, CLS, AA);
 
-        if ((HasTemporalReuse && *HasTemporalReuse) ||
-            (HasSpacialReuse && *HasSpacialReuse)) {
+        // Check for spacial reuse first: it only compares subscripts, while
+        // the temporal reuse check has to query dependence analysis.
+        bool HasReuse =
+            R->hasSpacialReuse(Representative, CLS, AA).value_or(false) ||
+            R->hasTemporalReuse(Representative, *TRT, *InnerMostLoop, DI, AA)
+                .value_or(false);
+
+        if (HasReuse) {
           RefGroup.push_back(std::move(R));
           Added = true;
           break;
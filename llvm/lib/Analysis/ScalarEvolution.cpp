@@ -144,6 +144,14 @@ STATISTIC(NumExitCountsNotComputed,
           "Number of loop exits without predictable exit counts");
 STATISTIC(NumBruteForceTripCountsComputed,
           "Number of loops with trip counts computed by force");
+STATISTIC(NumSCEVCacheHits,
+          "Number of getSCEV queries answered from the value map");
+STATISTIC(NumSCEVCacheMisses,
+          "Number of getSCEV queries that had to create an expression");
+STATISTIC(NumBackedgeTakenCacheHits,
+          "Number of backedge-taken info queries answered from the cache");
+STATISTIC(NumBackedgeTakenComputed,
+          "Number of loops whose backedge-taken info was computed");
 
 #ifdef EXPENSIVE_CHECKS
 bool llvm::VerifySCEV = true;
@@ -4534,8 +4542,11 @@ void ScalarEvolution::insertValueToMap(Value *V, const SCEV *S) {
 const SCEV *ScalarEvolution::getSCEV(Value *V) {
   assert(isSCEVable(V->getType()) && "Value is not SCEVable!");
 
-  if (const SCEV *S = getExistingSCEV(V))
+  if (const SCEV *S = getExistingSCEV(V)) {
+    ++NumSCEVCacheHits;
     return S;
+  }
+  ++NumSCEVCacheMisses;
   return createSCEVIter(V);
 }
 
@@ -8389,8 +8400,11 @@ ScalarEvolution::getBackedgeTakenInfo(const Loop *L) {
   // backedge-taken count, which could result in infinite recursion.
   std::pair<DenseMap<const Loop *, BackedgeTakenInfo>::iterator, bool> Pair =
       BackedgeTakenCounts.try_emplace(L);
-  if (!Pair.second)
+  if (!Pair.second) {
+    ++NumBackedgeTakenCacheHits;
     return Pair.first->second;
+  }
+  ++NumBackedgeTakenComputed;
 
   // computeBackedgeTakenCount may allocate memory for its result. Inserting it
   // into the BackedgeTakenCounts map transfers ownership. Otherwise, the result
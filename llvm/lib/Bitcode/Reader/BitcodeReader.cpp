@@ -7021,6 +7021,7 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
         continue;
       MDLoader->setStripTBAA(true);
       stripTBAA(F->getParent());
+      break;
     }
   }
 
@@ -7055,15 +7056,25 @@ Error BitcodeReader::materialize(GlobalValue *GV) {
       }
     }
 
-    // Remove incompatible attributes on function calls.
+    // Remove incompatible attributes on function calls. Most call sites carry
+    // few or no attributes, so don't build a mask for the ones that have none.
     if (auto *CI = dyn_cast<CallBase>(&I)) {
-      CI->removeRetAttrs(AttributeFuncs::typeIncompatible(
-          CI->getFunctionType()->getReturnType(), CI->getRetAttributes()));
+      if (CI->getAttributes().isEmpty())
+        continue;
+
+      AttributeSet RetAttrs = CI->getRetAttributes();
+      if (RetAttrs.hasAttributes())
+        CI->removeRetAttrs(AttributeFuncs::typeIncompatible(
+            CI->getFunctionType()->getReturnType(), RetAttrs));
 
-      for (unsigned ArgNo = 0; ArgNo < CI->arg_size(); ++ArgNo)
+      for (unsigned ArgNo = 0; ArgNo < CI->arg_size(); ++ArgNo) {
+        AttributeSet ParamAttrs = CI->getParamAttributes(ArgNo);
+        if (!ParamAttrs.hasAttributes())
+          continue;
         CI->removeParamAttrs(ArgNo, AttributeFuncs::typeIncompatible(
                                         CI->getArgOperand(ArgNo)->getType(),
-                                        CI->getParamAttributes(ArgNo)));
+                                        ParamAttrs));
+      }
     }
   }
 
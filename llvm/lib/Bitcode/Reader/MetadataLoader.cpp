@@ -80,6 +80,11 @@ static cl::opt<bool> DisableLazyLoading(
     cl::desc("Force disable the lazy-loading on-demand of metadata when "
              "loading bitcode for importing."));
 
+static cl::opt<bool> LazyLoadModuleMetadata(
+    "lazy-load-module-metadata", cl::init(false), cl::Hidden,
+    cl::desc("Load module-level metadata on demand when parsing whole modules, "
+             "not just when importing for ThinLTO."));
+
 namespace {
 
 static int64_t unrotateSign(uint64_t U) { return (U & 1) ? ~(U >> 1) : U >> 1; }
@@ -1067,8 +1072,11 @@ Error MetadataLoader::MetadataLoaderImpl::parseMetadata(bool ModuleLevel) {
 
   // We lazy-load module-level metadata: we build an index for each record, and
   // then load individual record as needed, starting with the named metadata.
-  if (ModuleLevel && IsImporting && MetadataList.empty() &&
-      !DisableLazyLoading) {
+  // When importing only a few functions most of the block is never needed;
+  // for whole modules this is opt-in, since materializing every function
+  // body eventually pulls in most of it anyway.
+  if (ModuleLevel && (IsImporting || LazyLoadModuleMetadata) &&
+      MetadataList.empty() && !DisableLazyLoading) {
     auto SuccessOrErr = lazyLoadModuleMetadataBlock();
     if (!SuccessOrErr)
       return SuccessOrErr.takeError();
@@ -5270,8 +5270,11 @@ void ModuleBitcodeWriter::write() {
   writeOperandBundleTags();
   writeSyncScopeNames();
 
-  // Emit function bodies.
+  // Emit function bodies. These are written one after another: each one is
+  // numbered by incorporating it into the shared ValueEnumerator, and is
+  // encoded relative to the module-level abbreviations and metadata IDs.
   DenseMap<const Function *, uint64_t> FunctionToBitcodeIndex;
+  FunctionToBitcodeIndex.reserve(M.size());
   for (const Function &F : M)
     if (!F.isDeclaration())
       writeFunction(F, FunctionToBitcodeIndex);
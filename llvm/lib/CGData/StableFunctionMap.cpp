@@ -93,13 +93,20 @@ void StableFunctionMap::insert(const StableFunction &Func) {
 
 void StableFunctionMap::merge(const StableFunctionMap &OtherMap) {
   assert(!Finalized && "Cannot merge after finalization");
+  // Names are shared by many entries, so translate each of the other map's
+  // ids once rather than looking up its name for every entry.
+  SmallVector<unsigned> OtherIdToId(OtherMap.IdToName.size(), ~0u);
+  auto GetId = [&](unsigned OtherId) {
+    unsigned &Id = OtherIdToId[OtherId];
+    if (Id == ~0u)
+      Id = getIdOrCreateForName(OtherMap.IdToName[OtherId]);
+    return Id;
+  };
   for (auto &[Hash, Funcs] : OtherMap.HashToFuncs) {
     auto &ThisFuncs = HashToFuncs[Hash];
     for (auto &Func : Funcs) {
-      auto FuncNameId =
-          getIdOrCreateForName(*OtherMap.getNameForId(Func->FunctionNameId));
-      auto ModuleNameId =
-          getIdOrCreateForName(*OtherMap.getNameForId(Func->ModuleNameId));
+      auto FuncNameId = GetId(Func->FunctionNameId);
+      auto ModuleNameId = GetId(Func->ModuleNameId);
       auto ClonedIndexOperandHashMap =
           std::make_unique<IndexOperandHashMapType>(*Func->IndexOperandHashMap);
       ThisFuncs.emplace_back(std::make_unique<StableFunctionEntry>(
@@ -205,10 +212,11 @@ void StableFunctionMap::finalize(bool SkipTrim) {
   for (auto It = HashToFuncs.begin(); It != HashToFuncs.end(); ++It) {
     auto &[StableHash, SFS] = *It;
 
-    // Group stable functions by ModuleIdentifier.
+    // Group stable functions by ModuleIdentifier. Compare the names in place;
+    // getNameForId() returns a copy of them.
     llvm::stable_sort(SFS, [&](const std::unique_ptr<StableFunctionEntry> &L,
                                const std::unique_ptr<StableFunctionEntry> &R) {
-      return *getNameForId(L->ModuleNameId) < *getNameForId(R->ModuleNameId);
+      return IdToName[L->ModuleNameId] < IdToName[R->ModuleNameId];
     });
 
     // Consider the first function as the root function.
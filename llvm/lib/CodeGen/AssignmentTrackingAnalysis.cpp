@@ -15,6 +15,7 @@
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/UniqueVector.h"
+#include "llvm/Analysis/OptimizationRemarkEmitter.h"
 #include "llvm/BinaryFormat/Dwarf.h"
 #include "llvm/IR/BasicBlock.h"
 #include "llvm/IR/DataLayout.h"
@@ -46,11 +47,23 @@ STATISTIC(NumDefsScanned, "Number of dbg locs that get scanned for removal");
 STATISTIC(NumDefsRemoved, "Number of dbg locs removed");
 STATISTIC(NumWedgesScanned, "Number of dbg wedges scanned");
 STATISTIC(NumWedgesChanged, "Number of dbg wedges changed");
+STATISTIC(NumFnsTooManyBlockVars,
+          "Number of functions whose var locs were dropped because of "
+          "-debug-ata-max-block-vars");
 
 static cl::opt<unsigned>
     MaxNumBlocks("debug-ata-max-blocks", cl::init(10000),
                  cl::desc("Maximum num basic blocks before debug info dropped"),
                  cl::Hidden);
+/// The dataflow keeps a live-in and a live-out set, each a few vectors as long
+/// as the number of tracked variables, for every block. Bound their total size
+/// so that functions with many blocks and many aggregates can't exhaust
+/// memory.
+static cl::opt<unsigned> MaxNumBlockVars(
+    "debug-ata-max-block-vars", cl::init(1 << 24),
+    cl::desc("Maximum num basic blocks times num tracked variable fragments "
+             "before debug info dropped"),
+    cl::Hidden);
 /// Option for debugging the pass, determines if the memory location fragment
 /// filling happens after generating the variable locations.
 static cl::opt<bool> EnableMemLocFragFill("mem-loc-frag-fill", cl::init(true),
@@ -2278,6 +2291,26 @@ bool AssignmentTrackingLowering::run(FunctionVarLocsBuilder *FnVarLocsBuilder) {
       Fn, FnVarLocs, *VarsWithStackSlot, UntaggedStoreVars, UnknownStoreVars,
       TrackedVariablesVectorSize);
 
+  if (uint64_t(Fn.size()) * TrackedVariablesVectorSize > MaxNumBlockVars) {
+    LLVM_DEBUG(dbgs() << "[AT] Dropping var locs in: " << Fn.getName()
+                      << ": too many blocks (" << Fn.size()
+                      << ") for the number of variables ("
+                      << TrackedVariablesVectorSize - 1 << ")\n");
+    ++NumFnsTooManyBlockVars;
+    OptimizationRemarkEmitter ORE(&Fn);
+    ORE.emit([&]() {
+      return OptimizationRemarkMissed(DEBUG_TYPE, "TooManyBlockVars",
+                                      Fn.getSubprogram(), &Fn.getEntryBlock())
+             << "variable locations dropped: " << ore::NV("Blocks", Fn.size())
+             << " blocks times "
+             << ore::NV("Variables", TrackedVariablesVectorSize - 1)
+             << " variables exceeds -debug-ata-max-block-vars="
+             << ore::NV("Limit", unsigned(MaxNumBlockVars));
+    });
+    at::deleteAll(&Fn);
+    return false;
+  }
+
   // Prepare for traversal.
   ReversePostOrderTraversal<Function *> RPOT(&Fn);
   std::priority_queue<unsigned int, std::vector<unsigned int>,
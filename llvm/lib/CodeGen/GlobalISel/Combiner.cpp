@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/CodeGen/GlobalISel/Combiner.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/PostOrderIterator.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/Statistic.h"
@@ -22,7 +23,13 @@
 #include "llvm/CodeGen/GlobalISel/MachineIRBuilder.h"
 #include "llvm/CodeGen/GlobalISel/Utils.h"
 #include "llvm/CodeGen/MachineOptimizationRemarkEmitter.h"
+#include "llvm/CodeGen/TargetInstrInfo.h"
+#include "llvm/CodeGen/TargetSubtargetInfo.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/raw_ostream.h"
+#include <cinttypes>
 
 #define DEBUG_TYPE "gi-combiner"
 
@@ -32,6 +39,13 @@ STATISTIC(NumOneIteration, "Number of functions with one iteration");
 STATISTIC(NumTwoIterations, "Number of functions with two iterations");
 STATISTIC(NumThreeOrMoreIterations,
           "Number of functions with three or more iterations");
+STATISTIC(NumCombineAttempts, "Number of instructions tried by the combiner");
+STATISTIC(NumCombinesApplied, "Number of tried instructions that combined");
+
+static cl::opt<bool> ReportOpcodeStats(
+    "gi-combiner-report-opcode-stats", cl::Hidden,
+    cl::desc("Print, per function and opcode, how many instructions the "
+             "combiner tried and how many of them were combined"));
 
 namespace llvm {
 cl::OptionCategory GICombinerOptionCategory(
@@ -272,6 +286,10 @@ bool Combiner::combineMachineInstrs() {
   bool MFChanged = false;
   bool Changed;
 
+  // Opcode -> (instructions tried, instructions combined), for
+  // -gi-combiner-report-opcode-stats.
+  DenseMap<unsigned, std::pair<uint64_t, uint64_t>> OpcodeStats;
+
   unsigned Iteration = 0;
   while (true) {
     ++Iteration;
@@ -311,11 +329,21 @@ bool Combiner::combineMachineInstrs() {
     while (!WorkList.empty()) {
       MachineInstr &CurrInst = *WorkList.pop_back_val();
       LLVM_DEBUG(dbgs() << "\nTry combining " << CurrInst);
+      // Read the opcode up front; a successful combine may erase CurrInst.
+      unsigned Opc = CurrInst.getOpcode();
       bool AppliedCombine = tryCombineAll(CurrInst);
       LLVM_DEBUG(WLObserver->reportFullyCreatedInstrs());
+      ++NumCombineAttempts;
+      if (ReportOpcodeStats) {
+        auto &[Tried, Combined] = OpcodeStats[Opc];
+        ++Tried;
+        Combined += AppliedCombine;
+      }
       Changed |= AppliedCombine;
-      if (AppliedCombine)
+      if (AppliedCombine) {
+        ++NumCombinesApplied;
         WLObserver->appliedCombine();
+      }
     }
     MFChanged |= Changed;
 
@@ -341,6 +369,26 @@ bool Combiner::combineMachineInstrs() {
   else
     ++NumThreeOrMoreIterations;
 
+  if (ReportOpcodeStats && !OpcodeStats.empty()) {
+    // Most-tried opcodes first; those are where the rule matching time goes.
+    SmallVector<std::pair<unsigned, std::pair<uint64_t, uint64_t>>, 0> Sorted(
+        OpcodeStats.begin(), OpcodeStats.end());
+    llvm::sort(Sorted, [](const auto &A, const auto &B) {
+      if (A.second.first != B.second.first)
+        return A.second.first > B.second.first;
+      return A.first < B.first;
+    });
+    const TargetInstrInfo &TII = *MF.getSubtarget().getInstrInfo();
+    raw_ostream &OS = errs();
+    OS << "GlobalISel combiner opcode stats for '" << MF.getName() << "' ("
+       << Iteration << " iterations)\n";
+    OS << format("%10s %10s  %s\n", "Tried", "Combined", "Opcode");
+    for (const auto &[Opc, Counts] : Sorted)
+      OS << format("%10" PRIu64 " %10" PRIu64 "  ", Counts.first,
+                   Counts.second)
+         << TII.getName(Opc) << '\n';
+  }
+
 #ifndef NDEBUG
   if (CSEInfo) {
     if (auto E = CSEInfo->verify()) {
@@ -3765,6 +3765,10 @@ bool InstrRefBasedLDV::ExtendRanges(MachineFunction &MF,
   // dataflow problem.
   buildMLocValueMap(MF, MInLocs, MOutLocs, MLocTransfer);
 
+  // The transfer functions are not needed past this point: free them rather
+  // than keeping them alive while the variable value problem is solved.
+  MLocTransfer.clear();
+
   // Patch up debug phi numbers, turning unknown block-live-in values into
   // either live-through machine values, or PHIs.
   for (auto &DBG_PHI : DebugPHINumToValue) {
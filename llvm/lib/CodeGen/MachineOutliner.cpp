@@ -438,6 +438,12 @@ struct MachineOutliner : public ModulePass {
   /// The current repeat number of machine outlining.
   unsigned OutlineRepeatedNum = 0;
 
+  /// Sizes of the previous round's instruction mapping. Each rerun maps
+  /// nearly the same instructions, so these pre-size the next round's mapper
+  /// and spare it from regrowing, and rehashing, its tables.
+  unsigned PrevMappedInstrs = 0;
+  unsigned PrevUniqueInstrs = 0;
+
   /// Set to true if the outliner should run on all functions in the module
   /// considered safe for outlining.
   /// Set to true by default for compatibility with llc's -run-pass option.
@@ -1408,6 +1414,7 @@ bool MachineOutliner::runOnModule(Module &M) {
   unsigned OutlinedFunctionNum = 0;
 
   OutlineRepeatedNum = 0;
+  PrevMappedInstrs = PrevUniqueInstrs = 0;
   if (!doOutline(M, OutlinedFunctionNum))
     return false;
 
@@ -1448,9 +1455,14 @@ bool MachineOutliner::doOutline(Module &M, unsigned &OutlinedFunctionNum) {
   // it here.
   OutlineFromLinkOnceODRs = EnableLinkOnceODROutlining;
   InstructionMapper Mapper(*MMI);
+  Mapper.UnsignedVec.reserve(PrevMappedInstrs);
+  Mapper.InstrList.reserve(PrevMappedInstrs);
+  Mapper.InstructionIntegerMap.reserve(PrevUniqueInstrs);
 
   // Prepare instruction mappings for the suffix tree.
   populateMapper(Mapper, M);
+  PrevMappedInstrs = Mapper.UnsignedVec.size();
+  PrevUniqueInstrs = Mapper.InstructionIntegerMap.size();
   std::vector<std::unique_ptr<OutlinedFunction>> FunctionList;
 
   // Find all of the outlining candidates.
@@ -110,6 +110,8 @@ STATISTIC(NumFailZeroMII, "Pipeliner abort due to zero MII");
 STATISTIC(NumFailNoSchedule, "Pipeliner abort due to no schedule found");
 STATISTIC(NumFailZeroStage, "Pipeliner abort due to zero stage");
 STATISTIC(NumFailLargeMaxStage, "Pipeliner abort due to too many stages");
+STATISTIC(NumFailIISearchBudget,
+          "Pipeliner abort due to the II search budget running out");
 
 /// A command line option to turn software pipelining on or off.
 static cl::opt<bool> EnableSWP("enable-pipeliner", cl::Hidden, cl::init(true),
@@ -179,6 +181,12 @@ static cl::opt<int> SwpIISearchRange("pipeliner-ii-search-range",
                                      cl::desc("Range to search for II"),
                                      cl::Hidden, cl::init(10));
 
+static cl::opt<unsigned> SwpIISearchBudget(
+    "pipeliner-ii-search-budget", cl::Hidden, cl::init(0),
+    cl::desc("Maximum number of instruction placements tried for one loop, "
+             "summed over all IIs, before giving up on pipelining it "
+             "(0 = unlimited)"));
+
 static cl::opt<bool>
     LimitRegPressure("pipeliner-register-pressure", cl::Hidden, cl::init(false),
                      cl::desc("Limit register pressure of scheduled loop"));
@@ -768,6 +776,9 @@ void SwingSchedulerDAG::schedule() {
 
   if (!Scheduled){
     LLVM_DEBUG(dbgs() << "No schedule found, return\n");
+    // The budget failure has already been counted and reported.
+    if (IISearchBudgetExhausted)
+      return;
     NumFailNoSchedule++;
     Pass.ORE->emit([&]() {
       return MachineOptimizationRemarkAnalysis(
@@ -2611,16 +2622,26 @@ bool SwingSchedulerDAG::schedulePipeline(SMSchedule &Schedule) {
         std::make_unique<HighRegisterPressureDetector>(Loop.getHeader(), MF);
     HRPDetector->init(RegClassInfo);
   }
-  // Keep increasing II until a valid schedule is found.
+  // Keep increasing II until a valid schedule is found, or until the search
+  // has tried SwpIISearchBudget placements in total. The budget is checked
+  // before each placement, so a single expensive II cannot overrun it.
+  unsigned Placements = 0;
   for (unsigned II = MII; II <= MAX_II && !scheduleFound; ++II) {
     Schedule.reset();
     Schedule.setInitiationInterval(II);
     LLVM_DEBUG(dbgs() << "Try to schedule with " << II << "\n");
 
+    bool BudgetExhausted = false;
     SetVector<SUnit *>::iterator NI = NodeOrder.begin();
     SetVector<SUnit *>::iterator NE = NodeOrder.end();
     do {
+      if (SwpIISearchBudget && Placements >= SwpIISearchBudget) {
+        BudgetExhausted = true;
+        scheduleFound = false;
+        break;
+      }
       SUnit *SU = *NI;
+      ++Placements;
 
       // Compute the schedule time for the instruction, which is based
       // upon the scheduled time for any predecessors/successors.
@@ -2676,6 +2697,21 @@ bool SwingSchedulerDAG::schedulePipeline(SMSchedule &Schedule) {
       });
     } while (++NI != NE && scheduleFound);
 
+    if (BudgetExhausted) {
+      LLVM_DEBUG(dbgs() << "II search budget exhausted at II=" << II << "\n");
+      NumFailIISearchBudget++;
+      IISearchBudgetExhausted = true;
+      Pass.ORE->emit([&]() {
+        return MachineOptimizationRemarkAnalysis(
+                   DEBUG_TYPE, "schedule", Loop.getStartLoc(),
+                   Loop.getHeader())
+               << "II search budget exhausted while trying II "
+               << ore::NV("II", II)
+               << ". Refer to -pipeliner-ii-search-budget.";
+      });
+      break;
+    }
+
     // If a schedule is found, ensure non-pipelined instructions are in stage 0
     if (scheduleFound)
       scheduleFound =
@@ -119,6 +119,13 @@ static cl::opt<unsigned long> GrowRegionComplexityBudget(
              "limit its budget and bail out once we reach the limit."),
     cl::init(10000), cl::Hidden);
 
+static cl::opt<unsigned> GreedyWorkBudget(
+    "regalloc-greedy-work-budget",
+    cl::desc("Maximum number of eviction attempts and split candidate "
+             "evaluations per function before the greedy allocator stops "
+             "evicting and splitting and spills instead (0 = unlimited)"),
+    cl::init(0), cl::Hidden);
+
 static cl::opt<bool> GreedyRegClassPriorityTrumpsGlobalness(
     "greedy-regclass-priority-trumps-globalness",
     cl::desc("Change the greedy register allocator's live range priority "
@@ -715,6 +722,7 @@ MCRegister RAGreedy::tryEvict(const LiveInterval &VirtReg,
                               const SmallVirtRegSet &FixedRegisters) {
   NamedRegionTimer T("evict", "Evict", TimerGroupName, TimerGroupDescription,
                      TimePassesIsEnabled);
+  chargeWork();
 
   MCRegister BestPhys = EvictAdvisor->tryFindEvictionCandidate(
       VirtReg, Order, CostPerUseLimit, FixedRegisters);
@@ -1231,6 +1239,8 @@ RAGreedy::calculateRegionSplitCostAroundReg(MCPhysReg PhysReg,
                                             BlockFrequency &BestCost,
                                             unsigned &NumCands,
                                             unsigned &BestCand) {
+  chargeWork();
+
   // Discard bad candidates before we run out of interference cache cursors.
   // This will only affect register classes with a lot of registers (>32).
   if (NumCands == IntfCache.getMaxCursors()) {
@@ -1938,6 +1948,7 @@ MCRegister RAGreedy::trySplit(const LiveInterval &VirtReg,
   // Ranges must be Split2 or less.
   if (ExtraInfo->getStage(VirtReg) >= RS_Spill)
     return MCRegister();
+  chargeWork();
 
   // Local intervals are handled separately.
   if (LIS->intervalIsInOneMBB(VirtReg)) {
@@ -2585,10 +2596,15 @@ MCRegister RAGreedy::selectOrSplitImpl(const LiveInterval &VirtReg,
   LLVM_DEBUG(dbgs() << StageName[Stage] << " Cascade "
                     << ExtraInfo->getCascade(VirtReg.reg()) << '\n');
 
+  // Once the work budget is spent, spillable ranges go straight to the spiller
+  // instead of evicting or splitting. Unspillable ranges, including the ones
+  // the spiller creates, still need eviction to find a register.
+  bool SkipToSpill = OverWorkBudget && VirtReg.isSpillable() && Stage < RS_Done;
+
   // Try to evict a less worthy live range, but only for ranges from the primary
   // queue. The RS_Split ranges already failed to do this, and they should not
   // get a second chance until they have been split.
-  if (Stage != RS_Split) {
+  if (Stage != RS_Split && !SkipToSpill) {
     if (MCRegister PhysReg =
             tryEvict(VirtReg, Order, NewVRegs, CostPerUseLimit,
                      FixedRegisters)) {
@@ -2609,14 +2625,14 @@ MCRegister RAGreedy::selectOrSplitImpl(const LiveInterval &VirtReg,
   // The first time we see a live range, don't try to split or spill.
   // Wait until the second time, when all smaller ranges have been allocated.
   // This gives a better picture of the interference to split around.
-  if (Stage < RS_Split) {
+  if (Stage < RS_Split && !SkipToSpill) {
     ExtraInfo->setStage(VirtReg, RS_Split);
     LLVM_DEBUG(dbgs() << "wait for second round\n");
     NewVRegs.push_back(VirtReg.reg());
     return MCRegister();
   }
 
-  if (Stage < RS_Spill && !VirtReg.empty()) {
+  if (Stage < RS_Spill && !VirtReg.empty() && !SkipToSpill) {
     // Try splitting VirtReg or interferences.
     unsigned NewVRegSizeBefore = NewVRegs.size();
     MCRegister PhysReg = trySplit(VirtReg, Order, NewVRegs, FixedRegisters);
@@ -2654,6 +2670,26 @@ MCRegister RAGreedy::selectOrSplitImpl(const LiveInterval &VirtReg,
   return MCRegister();
 }
 
+void RAGreedy::chargeWork() {
+  if (!GreedyWorkBudget || OverWorkBudget || ++WorkUnits < GreedyWorkBudget)
+    return;
+
+  OverWorkBudget = true;
+  LLVM_DEBUG(dbgs() << "Work budget of " << GreedyWorkBudget
+                    << " exhausted, spilling without eviction or splitting\n");
+  ORE->emit([&]() {
+    DebugLoc Loc;
+    if (auto *SP = MF->getFunction().getSubprogram())
+      Loc = DILocation::get(SP->getContext(), SP->getLine(), 1, SP);
+    return MachineOptimizationRemarkMissed(DEBUG_TYPE, "WorkBudgetExhausted",
+                                           Loc, &MF->front())
+           << "register allocation work budget of "
+           << ore::NV("WorkBudget", GreedyWorkBudget)
+           << " exhausted; remaining live ranges are spilled without eviction "
+              "or splitting";
+  });
+}
+
 void RAGreedy::RAGreedyStats::report(MachineOptimizationRemarkMissed &R) {
   using namespace ore;
   if (Spills) {
@@ -2891,6 +2927,8 @@ bool RAGreedy::run(MachineFunction &mf) {
   IntfCache.init(MF, Matrix->getLiveUnions(), Indexes, LIS, TRI);
   GlobalCand.resize(32);  // This will grow as needed.
   SetOfBrokenHints.clear();
+  WorkUnits = 0;
+  OverWorkBudget = false;
 
   allocatePhysRegs();
   tryHintsRecoloring();
@@ -210,6 +210,11 @@ private:
 
   uint8_t CutOffInfo = CutOffStage::CO_None;
 
+  /// Eviction attempts and split candidate evaluations so far in this
+  /// function, checked against -regalloc-greedy-work-budget.
+  unsigned WorkUnits = 0;
+  bool OverWorkBudget = false;
+
 #ifndef NDEBUG
   static const char *const StageName[];
 #endif
@@ -329,6 +334,9 @@ private:
                                   SmallLISet &RecoloringCandidates,
                                   const SmallVirtRegSet &FixedRegisters);
 
+  /// Account for one unit of eviction or splitting work, and switch to
+  /// spilling once the per-function budget runs out.
+  void chargeWork();
   MCRegister tryAssign(const LiveInterval &, AllocationOrder &,
                        SmallVectorImpl<Register> &, const SmallVirtRegSet &);
   MCRegister tryEvict(const LiveInterval &, AllocationOrder &,
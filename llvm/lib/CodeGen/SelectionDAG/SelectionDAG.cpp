@@ -1383,6 +1383,13 @@ void SelectionDAG::init(MachineFunction &NewMF,
   BFI = BFIin;
   MMI = &MMIin;
   FnVarLocs = VarLocs;
+
+  // Operand storage is recycled across the blocks of a function (see clear()),
+  // but release it between functions so one huge function doesn't pin its
+  // peak for the rest of the module.
+  assert(AllNodes.size() == 1 && "DAG not cleared before starting a function");
+  OperandRecycler.clear(OperandAllocator);
+  OperandAllocator.Reset();
 }
 
 SelectionDAG::~SelectionDAG() {
@@ -1447,9 +1454,11 @@ SDNode *SelectionDAG::FindNodeOrInsertPos(const FoldingSetNodeID &ID,
 }
 
 void SelectionDAG::clear() {
+  // Deallocating the nodes hands every operand list back to OperandRecycler,
+  // so keep the recycler and its slabs for the next block instead of freeing
+  // and reallocating them for each one. Shuffle masks share OperandAllocator
+  // and are released with it in init(). CSEMap keeps its buckets too.
   allnodes_clear();
-  OperandRecycler.clear(OperandAllocator);
-  OperandAllocator.Reset();
   CSEMap.clear();
 
   ExtendedValueTypeNodes.clear();
@@ -138,6 +138,12 @@ static cl::opt<bool> EnableFastISelFallbackReport(
     cl::desc("Emit a diagnostic when \"fast\" instruction selection "
              "falls back to SelectionDAG."));
 
+static cl::opt<bool> FastISelColdFunctions(
+    "fast-isel-cold-functions", cl::Hidden,
+    cl::desc("Select functions that are marked cold or that the profile "
+             "summary reports as having a cold entry with FastISel, as if "
+             "they were optnone"));
+
 static cl::opt<bool>
 UseMBPI("use-mbpi",
         cl::desc("use Machine Branch Probability Info"),
@@ -342,6 +348,24 @@ SelectionDAGISelLegacy::SelectionDAGISelLegacy(
   initializeTargetLibraryInfoWrapperPassPass(*PassRegistry::getPassRegistry());
 }
 
+/// Return the optimization level to select \p F with. optnone functions, and
+/// cold ones under -fast-isel-cold-functions, drop to CodeGenOptLevel::None,
+/// which routes them through FastISel where the target supports it.
+static CodeGenOptLevel getISelOptLevel(const Function &F, bool IsOptNone,
+                                       CodeGenOptLevel OptLevel,
+                                       ProfileSummaryInfo *PSI) {
+  if (IsOptNone)
+    return CodeGenOptLevel::None;
+  if (FastISelColdFunctions && OptLevel != CodeGenOptLevel::None &&
+      (F.hasFnAttribute(Attribute::Cold) ||
+       (PSI && PSI->hasProfileSummary() && PSI->isFunctionEntryCold(&F)))) {
+    LLVM_DEBUG(dbgs() << "Selecting cold function " << F.getName()
+                      << " at -O0\n");
+    return CodeGenOptLevel::None;
+  }
+  return OptLevel;
+}
+
 bool SelectionDAGISelLegacy::runOnMachineFunction(MachineFunction &MF) {
   // If we already selected that function, we do not need to run SDISel.
   if (MF.getProperties().hasSelected())
@@ -361,10 +385,10 @@ bool SelectionDAGISelLegacy::runOnMachineFunction(MachineFunction &MF) {
   // codegen looking at the optimization level explicitly when
   // it wants to look at it.
   Selector->TM.resetTargetOptions(MF.getFunction());
-  // Reset OptLevel to None for optnone functions.
-  CodeGenOptLevel NewOptLevel = skipFunction(MF.getFunction())
-                                    ? CodeGenOptLevel::None
-                                    : Selector->OptLevel;
+  // Reset OptLevel to None for optnone (and, if requested, cold) functions.
+  CodeGenOptLevel NewOptLevel = getISelOptLevel(
+      MF.getFunction(), skipFunction(MF.getFunction()), Selector->OptLevel,
+      &getAnalysis<ProfileSummaryInfoWrapperPass>().getPSI());
 
   Selector->MF = &MF;
   OptLevelChanger OLC(*Selector, NewOptLevel);
@@ -436,10 +460,12 @@ SelectionDAGISelPass::run(MachineFunction &MF,
   // Reset OptLevel to None for optnone functions.
   // TODO: Add a function analysis to handle this.
   Selector->MF = &MF;
-  // Reset OptLevel to None for optnone functions.
-  CodeGenOptLevel NewOptLevel = MF.getFunction().hasOptNone()
-                                    ? CodeGenOptLevel::None
-                                    : Selector->OptLevel;
+  // Reset OptLevel to None for optnone (and, if requested, cold) functions.
+  const Function &F = MF.getFunction();
+  auto *PSI = MFAM.getResult<ModuleAnalysisManagerMachineFunctionProxy>(MF)
+                  .getCachedResult<ProfileSummaryAnalysis>(*F.getParent());
+  CodeGenOptLevel NewOptLevel =
+      getISelOptLevel(F, F.hasOptNone(), Selector->OptLevel, PSI);
 
   OptLevelChanger OLC(*Selector, NewOptLevel);
   Selector->initializeAnalysisResults(MFAM);
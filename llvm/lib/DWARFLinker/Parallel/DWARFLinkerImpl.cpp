@@ -12,6 +12,7 @@
 #include "llvm/DebugInfo/DWARF/DWARFDebugAbbrev.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/Parallel.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/ThreadPool.h"
 
 using namespace llvm;
@@ -179,6 +180,8 @@ Error DWARFLinkerImpl::link() {
     llvm::parallel::strategy =
         hardware_concurrency(GlobalData.getOptions().Threads);
 
+  PhaseStart = std::chrono::steady_clock::now();
+
   // Link object files.
   if (GlobalData.getOptions().Threads == 1) {
     for (std::unique_ptr<LinkContext> &Context : ObjectContexts) {
@@ -201,6 +204,7 @@ Error DWARFLinkerImpl::link() {
 
     Pool.wait();
   }
+  finishPhase("Clone compile units");
 
   if (ArtificialTypeUnit != nullptr && !ArtificialTypeUnit->getTypePool()
                                             .getRoot()
@@ -211,6 +215,7 @@ Error DWARFLinkerImpl::link() {
       if (Error Err = ArtificialTypeUnit->finishCloningAndEmit(
               (*GlobalData.getTargetTriple()).get()))
         return Err;
+    finishPhase("Emit type unit");
   }
 
   // At this stage each compile units are cloned to their own set of debug
@@ -859,6 +864,7 @@ void DWARFLinkerImpl::glueCompileUnitsAndWriteToTheOutput() {
 
   // Patch size/offsets fields according to the assigned CU offsets.
   patchOffsetsAndSizes();
+  finishPhase("Assign offsets");
 
   // Emit common sections and write debug tables from all object files/compile
   // units into the resulting file.
@@ -872,11 +878,22 @@ void DWARFLinkerImpl::glueCompileUnitsAndWriteToTheOutput() {
 
   // Cleanup data.
   cleanupDataAfterDWARFOutputIsWritten();
+  finishPhase("Write output");
 
   if (GlobalData.getOptions().Statistics)
     printStatistic();
 }
 
+void DWARFLinkerImpl::finishPhase(StringRef Name) {
+  if (!GlobalData.getOptions().Statistics)
+    return;
+
+  auto Now = std::chrono::steady_clock::now();
+  PhaseStatistics.push_back(
+      {Name, Now - PhaseStart, sys::Process::GetMallocUsage()});
+  PhaseStart = Now;
+}
+
 void DWARFLinkerImpl::printStatistic() {
 
   // For each object file map how many bytes were emitted.
@@ -939,6 +956,21 @@ void DWARFLinkerImpl::printStatistic() {
                           ComputePercentange(InputTotal, OutputTotal));
   outs() << "----------------------------------------------------------------"
             "---------------\n\n";
+
+  // Print time and heap usage per phase.
+  const char *PhaseFormatStr = "{0,-45} {1,10:f3}s  {2,10}b\n";
+  outs() << "Linking phases\n";
+  outs() << "----------------------------------------------------------------"
+            "---------------\n";
+  outs() << "Phase                                               Time  "
+            "  Heap in use\n";
+  outs() << "----------------------------------------------------------------"
+            "---------------\n";
+  for (const PhaseStatistic &Phase : PhaseStatistics)
+    outs() << formatv(PhaseFormatStr, Phase.Name, Phase.Time.count(),
+                      Phase.MallocUsage);
+  outs() << "----------------------------------------------------------------"
+            "---------------\n\n";
 }
 
 void DWARFLinkerImpl::assignOffsets() {
@@ -17,6 +17,7 @@
 #include "llvm/CodeGen/AccelTable.h"
 #include "llvm/DWARFLinker/Parallel/DWARFLinker.h"
 #include "llvm/DWARFLinker/StringPool.h"
+#include <chrono>
 
 namespace llvm {
 namespace dwarf_linker {
@@ -290,6 +291,10 @@ protected:
   /// Print statistic for processed Debug Info.
   void printStatistic();
 
+  /// Record the time spent since the previous phase ended, and the heap in
+  /// use at the end of the phase, for printStatistic().
+  void finishPhase(StringRef Name);
+
   enum StringDestinationKind : uint8_t { DebugStr, DebugLineStr };
 
   /// Enumerates all strings.
@@ -370,6 +375,16 @@ protected:
 
   /// Overall compile units number.
   uint64_t OverallNumberOfCU = 0;
+
+  /// Time and heap usage of each linking phase, filled in only when
+  /// statistics are requested.
+  struct PhaseStatistic {
+    StringRef Name;
+    std::chrono::duration<double> Time;
+    size_t MallocUsage;
+  };
+  SmallVector<PhaseStatistic, 4> PhaseStatistics;
+  std::chrono::steady_clock::time_point PhaseStart;
   /// @}
 };
 
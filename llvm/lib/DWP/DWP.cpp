@@ -432,7 +432,11 @@ void writeStringsAndOffsets(MCStreamer &Out, DWPStringPool &Strings,
   if (CurStrSection.empty() || CurStrOffsetSection.empty())
     return;
 
+  // Strings in a .dwo file are normally all referenced from the offsets
+  // section, whose entries are at least four bytes, which gives a good
+  // estimate of the map size and avoids rehashing it for every input.
   DenseMap<uint64_t, uint32_t> OffsetRemapping;
+  OffsetRemapping.reserve(CurStrOffsetSection.size() / 4);
 
   DataExtractor Data(CurStrSection, true, 0);
   uint64_t LocalOffset = 0;
@@ -12,6 +12,7 @@
 #include "llvm/BinaryFormat/Dwarf.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/DJB.h"
+#include "llvm/Support/Endian.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/FormatVariadic.h"
@@ -979,8 +980,18 @@ DWARFDebugNames::ValueIterator::findEntryOffsetInCurrentIndex() {
   if (Index == 0)
     return std::nullopt; // Empty bucket
 
+  // Check once that the whole hash array lies within the section, then scan
+  // it directly rather than through the extractor.
+  const DWARFDataExtractor &AS = CurrentIndex->Section.AccelSection;
+  if (!AS.isValidOffsetForDataOfSize(CurrentIndex->Offsets.HashesBase,
+                                     4ull * Hdr.NameCount))
+    return std::nullopt;
+  const char *Hashes = AS.getData().data() + CurrentIndex->Offsets.HashesBase;
+  const llvm::endianness Endian =
+      AS.isLittleEndian() ? llvm::endianness::little : llvm::endianness::big;
   for (; Index <= Hdr.NameCount; ++Index) {
-    uint32_t HashAtIndex = CurrentIndex->getHashArrayEntry(Index);
+    uint32_t HashAtIndex =
+        support::endian::read32(Hashes + 4 * (Index - 1), Endian);
     if (HashAtIndex % Hdr.BucketCount != Bucket)
       return std::nullopt; // End of bucket
     // Only compare names if the hashes match.
@@ -49,11 +49,14 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/LEB128.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
+#include <chrono>
 #include <cstdint>
 #include <deque>
 #include <map>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -1392,19 +1395,33 @@ bool DWARFContext::verify(raw_ostream &OS, DIDumpOptions DumpOpts) {
   bool Success = true;
   DWARFVerifier verifier(OS, *this, DumpOpts);
 
-  Success &= verifier.handleDebugAbbrev();
+  SmallVector<std::pair<StringRef, std::chrono::duration<double>>, 8> Timings;
+  auto Run = [&](StringRef Name, bool (DWARFVerifier::*Check)()) {
+    auto Start = std::chrono::steady_clock::now();
+    Success &= (verifier.*Check)();
+    if (DumpOpts.ShowVerifyTimings)
+      Timings.emplace_back(Name, std::chrono::steady_clock::now() - Start);
+  };
+
+  Run("abbreviations", &DWARFVerifier::handleDebugAbbrev);
   if (DumpOpts.DumpType & DIDT_DebugCUIndex)
-    Success &= verifier.handleDebugCUIndex();
+    Run(".debug_cu_index", &DWARFVerifier::handleDebugCUIndex);
   if (DumpOpts.DumpType & DIDT_DebugTUIndex)
-    Success &= verifier.handleDebugTUIndex();
+    Run(".debug_tu_index", &DWARFVerifier::handleDebugTUIndex);
   if (DumpOpts.DumpType & DIDT_DebugInfo)
-    Success &= verifier.handleDebugInfo();
+    Run("units", &DWARFVerifier::handleDebugInfo);
   if (DumpOpts.DumpType & DIDT_DebugLine)
-    Success &= verifier.handleDebugLine();
+    Run("line tables", &DWARFVerifier::handleDebugLine);
   if (DumpOpts.DumpType & DIDT_DebugStrOffsets)
-    Success &= verifier.handleDebugStrOffsets();
-  Success &= verifier.handleAccelTables();
+    Run(".debug_str_offsets", &DWARFVerifier::handleDebugStrOffsets);
+  Run("accelerator tables", &DWARFVerifier::handleAccelTables);
   verifier.summarize();
+
+  if (DumpOpts.ShowVerifyTimings) {
+    OS << "Verification timings:\n";
+    for (const auto &[Name, Time] : Timings)
+      OS << format("  %-20s %10.3fs\n", Name.str().c_str(), Time.count());
+  }
   return Success;
 }
 
@@ -2067,6 +2084,10 @@ class DWARFObjInMemory final : public DWARFObject {
   // new decompressed sections are inserted at the end.
   std::deque<SmallString<0>> UncompressedSections;
 
+  // Contents of compressed sections that were inflated ahead of the main
+  // section walk by decompressSectionsInParallel.
+  DenseMap<object::SectionRef, StringRef> PredecompressedSections;
+
   StringRef *mapSectionToMember(StringRef Name) {
     if (DWARFSection *Sec = mapNameToDWARFSection(Name))
       return &Sec->Data;
@@ -2094,6 +2115,12 @@ class DWARFObjInMemory final : public DWARFObject {
     if (!Sec.isCompressed())
       return Error::success();
 
+    auto It = PredecompressedSections.find(Sec);
+    if (It != PredecompressedSections.end()) {
+      Data = It->second;
+      return Error::success();
+    }
+
     Expected<Decompressor> Decompressor =
         Decompressor::create(Name, Data, IsLittleEndian, AddressSize == 8);
     if (!Decompressor)
@@ -2109,6 +2136,58 @@ class DWARFObjInMemory final : public DWARFObject {
     return Error::success();
   }
 
+  /// Inflate the compressed sections of \p Obj concurrently, since each one
+  /// is independent and decompression dominates the cost of creating a
+  /// context for binaries built with compressed debug sections. Sections that
+  /// fail are left to maybeDecompress, which reports the error.
+  void decompressSectionsInParallel(const object::ObjectFile &Obj) {
+    struct CompressedSection {
+      SectionRef Section;
+      StringRef Name;
+      StringRef Data;
+      std::optional<SmallString<0>> Out;
+    };
+    std::vector<CompressedSection> Compressed;
+    for (const SectionRef &Section : Obj.sections()) {
+      if (!Section.isCompressed() || Section.isBSS() || Section.isVirtual() ||
+          Section.isStripped())
+        continue;
+      Expected<StringRef> Name = Section.getName();
+      Expected<StringRef> Data = Section.getContents();
+      if (!Name || !Data) {
+        consumeError(Name.takeError());
+        consumeError(Data.takeError());
+        continue;
+      }
+      Compressed.push_back({Section, *Name, *Data, std::nullopt});
+    }
+    if (Compressed.size() < 2)
+      return;
+
+    parallelFor(0, Compressed.size(), [&](size_t I) {
+      CompressedSection &C = Compressed[I];
+      Expected<Decompressor> D = Decompressor::create(
+          C.Name, C.Data, IsLittleEndian, AddressSize == 8);
+      if (!D) {
+        consumeError(D.takeError());
+        return;
+      }
+      SmallString<0> Out;
+      if (Error Err = D->resizeAndDecompress(Out)) {
+        consumeError(std::move(Err));
+        return;
+      }
+      C.Out = std::move(Out);
+    });
+
+    for (CompressedSection &C : Compressed) {
+      if (!C.Out)
+        continue;
+      UncompressedSections.push_back(std::move(*C.Out));
+      PredecompressedSections[C.Section] = UncompressedSections.back();
+    }
+  }
+
 public:
   DWARFObjInMemory(const StringMap<std::unique_ptr<MemoryBuffer>> &Sections,
                    uint8_t AddrSize, bool IsLittleEndian)
@@ -2136,6 +2215,12 @@ public:
         AddressSize(Obj.getBytesInAddress()), FileName(Obj.getFileName()),
         Obj(&Obj) {
 
+    // With a LoadedObjectInfo the section contents may come from the loaded
+    // image instead, so only inflate the object's own sections up front when
+    // there is none.
+    if (!L)
+      decompressSectionsInParallel(Obj);
+
     StringMap<unsigned> SectionAmountMap;
     for (const SectionRef &Section : Obj.sections()) {
       StringRef Name;
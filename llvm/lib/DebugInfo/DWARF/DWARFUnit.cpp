@@ -502,6 +502,12 @@ Error DWARFUnit::tryExtractDIEsIfNeeded(bool CUDieOnly) {
   bool HasCUDie = !DieArray.empty();
   extractDIEsToVector(!HasCUDie, !CUDieOnly, DieArray);
 
+  // extractDIEsToVector reserves space from an estimate of the DIE size. The
+  // array lives as long as the unit, so release a large unused tail; large
+  // binaries otherwise carry it for every unit a lookup has touched.
+  if (DieArray.capacity() > DieArray.size() + DieArray.size() / 4)
+    DieArray.shrink_to_fit();
+
   if (DieArray.empty())
     return Error::success();
 
@@ -656,6 +656,9 @@ Error DwarfTransformer::convert(uint32_t NumThreads, OutputAggregator &Out) {
       DWARFDie Die = getDie(*CU);
       CUInfo CUI(DICtx, dyn_cast<DWARFCompileUnit>(CU.get()));
       handleDie(Out, CUI, Die);
+      // The line table was only needed for this unit's functions, whose line
+      // entries are now in the GsymCreator. Free it to bound peak memory.
+      DICtx.clearLineTableForUnit(CU.get());
     }
   } else {
     // LLVM Dwarf parser is not thread-safe and we need to parse all DWARF up
@@ -696,6 +699,11 @@ Error DwarfTransformer::convert(uint32_t NumThreads, OutputAggregator &Out) {
       }
     }
     pool.wait();
+
+    // Units may share a line table, and each task holds a pointer to its
+    // unit's table, so only free them once all tasks are done.
+    for (const auto &CU : DICtx.compile_units())
+      DICtx.clearLineTableForUnit(CU.get());
   }
   size_t FunctionsAddedCount = Gsym.getNumFunctionInfos() - NumBefore;
   Out << "Loaded " << FunctionsAddedCount << " functions from DWARF.\n";
@@ -46,6 +46,7 @@
 
 namespace llvm {
 
+using llvm::object::BuildID;
 using llvm::object::BuildIDRef;
 
 namespace {
@@ -159,6 +160,21 @@ Expected<std::string> getCachedOrDownloadDebuginfo(BuildIDRef ID) {
   return getCachedOrDownloadArtifact(getDebuginfodCacheKey(UrlPath), UrlPath);
 }
 
+size_t prefetchDebuginfo(ArrayRef<BuildID> IDs, ThreadPoolInterface &Pool) {
+  std::atomic<size_t> NumAvailable = 0;
+  ThreadPoolTaskGroup Group(Pool);
+  for (const BuildID &ID : IDs)
+    Group.async([&NumAvailable, ID = BuildIDRef(ID)] {
+      Expected<std::string> PathOrErr = getCachedOrDownloadDebuginfo(ID);
+      if (PathOrErr)
+        ++NumAvailable;
+      else
+        consumeError(PathOrErr.takeError());
+    });
+  Group.wait();
+  return NumAvailable;
+}
+
 // General fetching function.
 Expected<std::string> getCachedOrDownloadArtifact(StringRef UniqueKey,
                                                   StringRef UrlPath) {
@@ -129,6 +129,11 @@ private:
     return static_cast<const LinkerImpl &>(*this);
   }
 
+  // Fixups are applied on the linking thread. Each fixup only writes to its
+  // own block, but copying no-alloc content allocates from the LinkGraph's
+  // allocator, which is not thread-safe, and the error reported must be the
+  // one for the first failing edge. Independent graphs can already be linked
+  // concurrently by dispatching them through the ExecutionSession.
   Error fixUpBlocks(LinkGraph &G) const override {
     LLVM_DEBUG(dbgs() << "Fixing up blocks:\n");
 
@@ -43,8 +43,12 @@ InProcessMemoryMapper::Create() {
 void InProcessMemoryMapper::reserve(size_t NumBytes,
                                     OnReservedFunction OnReserved) {
   std::error_code EC;
+  // Reservations are slabs shared by many graphs, so ask for huge pages to
+  // reduce iTLB pressure from long-running JITs.
   auto MB = sys::Memory::allocateMappedMemory(
-      NumBytes, nullptr, sys::Memory::MF_READ | sys::Memory::MF_WRITE, EC);
+      NumBytes, nullptr,
+      sys::Memory::MF_READ | sys::Memory::MF_WRITE | sys::Memory::MF_HUGE_HINT,
+      EC);
 
   if (EC)
     return OnReserved(errorCodeToError(EC));
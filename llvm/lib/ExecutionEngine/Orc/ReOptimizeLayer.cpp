@@ -1,5 +1,9 @@
 #include "llvm/ExecutionEngine/Orc/ReOptimizeLayer.h"
 #include "llvm/ExecutionEngine/Orc/Mangling.h"
+#include "llvm/Support/Debug.h"
+#include <chrono>
+
+#define DEBUG_TYPE "orc"
 
 using namespace llvm;
 using namespace orc;
@@ -100,7 +104,8 @@ Error ReOptimizeLayer::reoptimizeIfCallFrequent(ReOptimizeLayer &Parent,
       auto &BB = F.getEntryBlock();
       auto *IP = &*BB.getFirstInsertionPt();
       IRBuilder<> IRB(IP);
-      Value *Threshold = ConstantInt::get(I64Ty, CallCountThreshold, true);
+      Value *Threshold =
+          ConstantInt::get(I64Ty, Parent.getCallCountThreshold(), true);
       Value *Cnt = IRB.CreateLoad(I64Ty, Counter);
       // Use EQ to prevent further reoptimize calls.
       Value *Cmp = IRB.CreateICmpEQ(Cnt, Threshold);
@@ -164,6 +169,10 @@ void ReOptimizeLayer::rt_reoptimize(SendErrorFn SendResult,
     return;
   }
 
+#ifndef NDEBUG
+  auto StartTime = std::chrono::steady_clock::now();
+#endif
+
   ThreadSafeModule TSM = cloneToNewContext(MUState.getThreadSafeModule());
   auto OldRT = MUState.getResourceTracker();
   auto &JD = OldRT->getJITDylib();
@@ -192,6 +201,12 @@ void ReOptimizeLayer::rt_reoptimize(SendErrorFn SendResult,
   }
 
   MUState.reoptimizeSucceeded();
+  LLVM_DEBUG({
+    auto Elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - StartTime);
+    dbgs() << "ReOptimizeLayer: unit " << MUID << " reached version "
+           << (CurVersion + 1) << " in " << Elapsed.count() << "us\n";
+  });
   SendResult(Error::success());
 }
 
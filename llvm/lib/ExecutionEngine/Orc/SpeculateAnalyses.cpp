@@ -14,8 +14,11 @@
 #include "llvm/Analysis/BlockFrequencyInfo.h"
 #include "llvm/Analysis/BranchProbabilityInfo.h"
 #include "llvm/Analysis/CFG.h"
-#include "llvm/IR/PassManager.h"
-#include "llvm/Passes/PassBuilder.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/PostDominators.h"
+#include "llvm/Analysis/TargetLibraryInfo.h"
+#include "llvm/IR/Dominators.h"
+#include "llvm/IR/Module.h"
 #include "llvm/Support/ErrorHandling.h"
 
 namespace {
@@ -37,6 +40,24 @@ SmallVector<const BasicBlock *, 8> findBBwithCalls(const Function &F,
 
   return BBs;
 }
+
+// The analyses needed for block frequencies, computed the same way the
+// function analysis pipeline would. Queries run once per speculated function,
+// so avoid constructing a PassBuilder and registering every function analysis
+// each time.
+struct BlockFrequencies {
+  DominatorTree DT;
+  PostDominatorTree PDT;
+  LoopInfo LI;
+  TargetLibraryInfoImpl TLII;
+  TargetLibraryInfo TLI;
+  BranchProbabilityInfo BPI;
+  BlockFrequencyInfo BFI;
+
+  explicit BlockFrequencies(Function &F)
+      : DT(F), PDT(F), LI(DT), TLII(F.getParent()->getTargetTriple()),
+        TLI(TLII, &F), BPI(F, LI, &TLI, &DT, &PDT), BFI(F, BPI, LI) {}
+};
 } // namespace
 
 // Implementations of Queries shouldn't need to lock the resources
@@ -87,16 +108,13 @@ BlockFreqQuery::ResultTy BlockFreqQuery::operator()(Function &F) {
   DenseSet<StringRef> Calles;
   SmallVector<std::pair<const BasicBlock *, uint64_t>, 8> BBFreqs;
 
-  PassBuilder PB;
-  FunctionAnalysisManager FAM;
-  PB.registerFunctionAnalyses(FAM);
-
   auto IBBs = findBBwithCalls(F);
 
   if (IBBs.empty())
     return std::nullopt;
 
-  auto &BFI = FAM.getResult<BlockFrequencyAnalysis>(F);
+  BlockFrequencies Freqs(F);
+  auto &BFI = Freqs.BFI;
 
   for (const auto I : IBBs)
     BBFreqs.push_back({I, BFI.getBlockFreq(I).getFrequency()});
@@ -234,11 +252,8 @@ SequenceBBQuery::queryCFG(Function &F, const BlockListTy &CallerBlocks) {
   VisitedBlocksInfoTy VisitedBlocks;
   BackEdgesInfoTy BackEdgesInfo;
 
-  PassBuilder PB;
-  FunctionAnalysisManager FAM;
-  PB.registerFunctionAnalyses(FAM);
-
-  auto &BFI = FAM.getResult<BlockFrequencyAnalysis>(F);
+  BlockFrequencies Freqs(F);
+  auto &BFI = Freqs.BFI;
 
   llvm::FindFunctionBackedges(F, BackEdgesInfo);
 
@@ -254,8 +269,7 @@ SequenceBBQuery::queryCFG(Function &F, const BlockListTy &CallerBlocks) {
   HotBlocksRef =
       HotBlocksRef.drop_back(BBFreqs.size() - getHottestBlocks(BBFreqs.size()));
 
-  BranchProbabilityInfo *BPI =
-      FAM.getCachedResult<BranchProbabilityAnalysis>(F);
+  BranchProbabilityInfo *BPI = &Freqs.BPI;
 
   // visit NHotBlocks,
   // traverse upwards to entry
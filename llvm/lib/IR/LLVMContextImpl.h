@@ -1667,6 +1667,10 @@ public:
 
   DenseMap<const Value *, ValueName *> ValueNames;
 
+  // The uniquing tables below are deliberately unsynchronized. Locking them
+  // alone would not make a context shareable between threads: values created
+  // from them are also linked into use lists, symbol tables and the Alloc
+  // bump allocator, none of which can be updated concurrently.
   DenseMap<unsigned, std::unique_ptr<ConstantInt>> IntZeroConstants;
   DenseMap<unsigned, std::unique_ptr<ConstantInt>> IntOneConstants;
   DenseMap<APInt, std::unique_ptr<ConstantInt>> IntConstants;
@@ -7503,9 +7503,19 @@ bool llvm::verifyModule(const Module &M, raw_ostream *OS,
   // Don't use a raw_null_ostream.  Printing IR is expensive.
   Verifier V(OS, /*ShouldTreatBrokenDebugInfoAsError=*/!BrokenDebugInfo, M);
 
+  // Functions are verified one at a time by the same Verifier: the module
+  // level checks in verify() rely on what was collected while visiting them,
+  // e.g. the DISubprogram attachments and llvm.localescape counts.
+  //
+  // When nobody asked for the diagnostics, the answer is known as soon as one
+  // function is broken, and verifying the rest would only cost time.
+  bool StopAtFirstError = !OS && !BrokenDebugInfo;
   bool Broken = false;
-  for (const Function &F : M)
+  for (const Function &F : M) {
     Broken |= !V.verify(F);
+    if (Broken && StopAtFirstError)
+      return true;
+  }
 
   Broken |= !V.verify();
   if (BrokenDebugInfo)
@@ -61,6 +61,7 @@
 #include "llvm/Transforms/Utils/FunctionImportUtils.h"
 #include "llvm/Transforms/Utils/SplitModule.h"
 
+#include <atomic>
 #include <optional>
 #include <set>
 
@@ -88,6 +89,15 @@ static cl::opt<bool>
     LTOKeepSymbolCopies("lto-keep-symbol-copies", cl::init(false), cl::Hidden,
                         cl::desc("Keep copies of symbols in LTO indexing"));
 
+static cl::opt<bool> ThinLTOReuseImportLists(
+    "thinlto-reuse-import-lists", cl::init(false), cl::Hidden,
+    cl::desc("Save the import lists computed by the thin link in the ThinLTO "
+             "cache directory, and reuse them in links with the same inputs"));
+
+static cl::opt<bool>
+    LTOReportMemory("lto-report-memory", cl::init(false), cl::Hidden,
+                    cl::desc("Report heap usage at the end of each LTO phase"));
+
 /// Indicate we are linking with an allocator that supports hot/cold operator
 /// new interfaces.
 extern cl::opt<bool> SupportsHotColdNew;
@@ -96,6 +106,22 @@ extern cl::opt<bool> SupportsHotColdNew;
 extern cl::opt<bool> EnableMemProfContextDisambiguation;
 } // namespace llvm
 
+// Prints the heap usage and the size of the combined index at the end of the
+// given phase, along with the largest heap usage seen at any earlier phase.
+static void reportMemory(StringRef Phase, const ModuleSummaryIndex &Index) {
+  if (!LTOReportMemory)
+    return;
+  static std::atomic<size_t> Peak = 0;
+  size_t Usage = sys::Process::GetMallocUsage();
+  size_t Prev = Peak.load();
+  while (Prev < Usage && !Peak.compare_exchange_weak(Prev, Usage))
+    ;
+  errs() << "LTO memory: " << Phase << ": " << (Usage >> 20) << " MiB (peak "
+         << (std::max(Prev, Usage) >> 20) << " MiB), "
+         << Index.modulePaths().size() << " modules, " << Index.size()
+         << " summary GUIDs\n";
+}
+
 // Computes a unique hash for the Module considering the current list of
 // export/import and other global analysis results.
 // Returns the hash in its hexadecimal representation.
@@ -615,6 +641,8 @@ LTO::LTO(Config Conf, ThinBackend Backend,
       ThinLTO(std::move(Backend)),
       GlobalResolutions(
           std::make_unique<DenseMap<StringRef, GlobalResolution>>()),
+      IRNameAlloc(std::make_unique<BumpPtrAllocator>()),
+      IRNameSaver(std::make_unique<UniqueStringSaver>(*IRNameAlloc)),
       LTOMode(LTOMode) {
   if (Conf.KeepSymbolNameCopies || LTOKeepSymbolCopies) {
     Alloc = std::make_unique<BumpPtrAllocator>();
@@ -648,7 +676,7 @@ void LTO::addModuleToGlobalRes(ArrayRef<InputFile::Symbol> Syms,
       assert(!GlobalRes.Prevailing &&
              "Multiple prevailing defs are not allowed");
       GlobalRes.Prevailing = true;
-      GlobalRes.IRName = std::string(Sym.getIRName());
+      GlobalRes.IRName = IRNameSaver->save(Sym.getIRName());
     } else if (!GlobalRes.Prevailing && GlobalRes.IRName.empty()) {
       // Sometimes it can be two copies of symbol in a module and prevailing
       // symbol can have no IR name. That might happen if symbol is defined in
@@ -656,7 +684,7 @@ void LTO::addModuleToGlobalRes(ArrayRef<InputFile::Symbol> Syms,
       // the same symbol we want to use IR name of the prevailing symbol.
       // Otherwise, if we haven't seen a prevailing symbol, set the name so that
       // we can later use it to check if there is any prevailing copy in IR.
-      GlobalRes.IRName = std::string(Sym.getIRName());
+      GlobalRes.IRName = IRNameSaver->save(Sym.getIRName());
     }
 
     // In rare occasion, the symbol used to initialize GlobalRes has a different
@@ -702,6 +730,8 @@ void LTO::releaseGlobalResolutionsMemory() {
   // Release the string saver memory.
   GlobalResolutionSymbolSaver.reset();
   Alloc.reset();
+  IRNameSaver.reset();
+  IRNameAlloc.reset();
 }
 
 static void writeToResolutionFile(raw_ostream &OS, InputFile *Input,
@@ -1052,8 +1082,8 @@ Error LTO::addThinLTO(BitcodeModule BM, ArrayRef<InputFile::Symbol> Syms,
   if (Error Err =
           BM.readSummary(ThinLTO.CombinedIndex, BM.getModuleIdentifier(),
                          [&](GlobalValue::GUID GUID) {
-                           return ThinLTO.PrevailingModuleForGUID[GUID] ==
-                                  BM.getModuleIdentifier();
+                           return ThinLTO.PrevailingModuleForGUID.lookup(
+                                      GUID) == BM.getModuleIdentifier();
                          }))
     return Err;
   LLVM_DEBUG(dbgs() << "Module " << BM.getModuleIdentifier() << "\n");
@@ -1067,7 +1097,7 @@ Error LTO::addThinLTO(BitcodeModule BM, ArrayRef<InputFile::Symbol> Syms,
           GlobalValue::getGlobalIdentifier(Sym.getIRName(),
                                            GlobalValue::ExternalLinkage, ""));
       if (Res.Prevailing) {
-        assert(ThinLTO.PrevailingModuleForGUID[GUID] ==
+        assert(ThinLTO.PrevailingModuleForGUID.lookup(GUID) ==
                BM.getModuleIdentifier());
 
         // For linker redefined symbols (via --wrap or --defsym) we want to
@@ -1165,6 +1195,8 @@ Error LTO::checkPartiallySplit() {
 }
 
 Error LTO::run(AddStreamFn AddStream, FileCache Cache) {
+  reportMemory("add", ThinLTO.CombinedIndex);
+
   // Compute "dead" symbols, we don't want to import/export these!
   DenseSet<GlobalValue::GUID> GUIDPreservedSymbols;
   DenseMap<GlobalValue::GUID, PrevailingType> GUIDPrevailingResolutions;
@@ -1547,6 +1579,15 @@ public:
     assert(ModuleToDefinedGVSummaries.count(ModulePath));
     const GVSummaryMapTy &DefinedGlobals =
         ModuleToDefinedGVSummaries.find(ModulePath)->second;
+    // Let a cache with slow lookups start fetching while earlier backends are
+    // still running. The key is recomputed when the backend thread runs.
+    if (Cache.isValid() && Cache.canPrefetch() &&
+        CombinedIndex.modulePaths().count(ModulePath) &&
+        !all_of(CombinedIndex.getModuleHash(ModulePath),
+                [](uint32_t V) { return V == 0; }))
+      Cache.prefetch(computeLTOCacheKey(
+          Conf, CombinedIndex, ModulePath, ImportList, ExportList, ResolvedODR,
+          DefinedGlobals, CfiFunctionDefs, CfiFunctionDecls));
     BackendThreadPool.async(
         [=](BitcodeModule BM, ModuleSummaryIndex &CombinedIndex,
             const FunctionImporter::ImportMapTy &ImportList,
@@ -1885,6 +1926,254 @@ ThinBackend lto::createWriteIndexesThinBackend(
   return ThinBackend(Func, Parallelism);
 }
 
+// Computes a key for the inputs of the cross-module import computation, or
+// returns an empty string if they cannot be identified. The key covers every
+// module hash together with the symbol resolution state that the thin link
+// derives liveness and prevailing copies from.
+static std::string computeThinLinkImportsKey(
+    const Config &Conf, const ModuleSummaryIndex &Index,
+    ArrayRef<StringRef> Modules,
+    const DenseSet<GlobalValue::GUID> &GUIDPreservedSymbols,
+    const DenseSet<GlobalValue::GUID> &DynamicExportSymbols,
+    const DenseMap<GlobalValue::GUID, StringRef> &PrevailingModuleForGUID) {
+  std::string OptionsKey = getCrossModuleImportOptionsKey();
+  if (OptionsKey.empty())
+    return "";
+
+  SHA1 Hasher;
+  Hasher.update(LLVM_VERSION_STRING);
+#ifdef LLVM_REVISION
+  Hasher.update(LLVM_REVISION);
+#endif
+  auto AddString = [&](StringRef Str) {
+    Hasher.update(Str);
+    Hasher.update(ArrayRef<uint8_t>{0});
+  };
+  auto AddUint64 = [&](uint64_t I) {
+    uint8_t Data[8];
+    support::endian::write64le(Data, I);
+    Hasher.update(Data);
+  };
+  auto AddGUIDs = [&](const DenseSet<GlobalValue::GUID> &Set) {
+    std::vector<GlobalValue::GUID> GUIDs(Set.begin(), Set.end());
+    llvm::sort(GUIDs);
+    AddUint64(GUIDs.size());
+    for (GlobalValue::GUID GUID : GUIDs)
+      AddUint64(GUID);
+  };
+
+  AddString(OptionsKey);
+  AddUint64(Conf.OptLevel);
+  AddUint64(Conf.HasWholeProgramVisibility);
+  AddUint64(Conf.ValidateAllVtablesHaveTypeInfos);
+  AddUint64(Conf.AllVtablesHaveTypeInfos);
+  AddUint64(EnableMemProfContextDisambiguation);
+  AddUint64(SupportsHotColdNew);
+
+  for (StringRef Mod : Modules) {
+    if (!Index.modulePaths().count(Mod))
+      return "";
+    const ModuleHash &Hash = Index.getModuleHash(Mod);
+    if (all_of(Hash, [](uint32_t V) { return V == 0; }))
+      return "";
+    AddString(Mod);
+    Hasher.update(ArrayRef<uint8_t>((const uint8_t *)&Hash[0], sizeof(Hash)));
+  }
+
+  AddGUIDs(GUIDPreservedSymbols);
+  AddGUIDs(DynamicExportSymbols);
+
+  std::vector<std::pair<GlobalValue::GUID, StringRef>> Prevailing(
+      PrevailingModuleForGUID.begin(), PrevailingModuleForGUID.end());
+  llvm::sort(Prevailing);
+  for (auto &[GUID, Mod] : Prevailing) {
+    AddUint64(GUID);
+    AddString(Mod);
+  }
+
+  return toHex(Hasher.result());
+}
+
+static constexpr StringLiteral ThinLinkImportsMagic = "thinlto-imports-v1";
+
+// Saves the import lists in a line-based format. The module paths are written
+// once, and the import entries refer to them by index in Modules.
+static void saveImportLists(StringRef Path, ArrayRef<StringRef> Modules,
+                            const FunctionImporter::ImportListsTy &ImportLists) {
+  DenseMap<StringRef, unsigned> ModuleIndex;
+  for (auto [I, Mod] : enumerate(Modules))
+    ModuleIndex[Mod] = I;
+
+  Error E = writeToOutput(Path, [&](raw_ostream &OS) -> Error {
+    OS << ThinLinkImportsMagic << '\n' << Modules.size() << '\n';
+    for (StringRef Mod : Modules)
+      OS << Mod << '\n';
+    for (auto [I, Mod] : enumerate(Modules)) {
+      const FunctionImporter::ImportMapTy &List = ImportLists.lookup(Mod);
+      if (List.begin() == List.end())
+        continue;
+      OS << I << ' ' << std::distance(List.begin(), List.end()) << '\n';
+      for (const auto &[FromModule, GUID, ImportType] : List) {
+        auto It = ModuleIndex.find(FromModule);
+        if (It == ModuleIndex.end())
+          return createStringError("unknown import source " + FromModule);
+        OS << It->second << ' ' << GUID << ' ' << unsigned(ImportType)
+           << '\n';
+      }
+    }
+    return Error::success();
+  });
+  // The saved lists are only an optimization for a later link.
+  consumeError(std::move(E));
+}
+
+// Loads import lists saved by saveImportLists for the same list of modules.
+// Returns false, leaving ImportLists untouched, if the file is missing or does
+// not match.
+static bool loadImportLists(StringRef Path, ArrayRef<StringRef> Modules,
+                            FunctionImporter::ImportListsTy &ImportLists) {
+  ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr =
+      MemoryBuffer::getFile(Path, /*IsText=*/true);
+  if (!MBOrErr)
+    return false;
+
+  SmallVector<StringRef, 0> Lines;
+  (*MBOrErr)->getBuffer().split(Lines, '\n', /*MaxSplit=*/-1,
+                                /*KeepEmpty=*/false);
+  size_t NumModules;
+  if (Lines.size() < 2 || Lines[0] != ThinLinkImportsMagic ||
+      Lines[1].getAsInteger(10, NumModules) || NumModules != Modules.size() ||
+      Lines.size() < 2 + NumModules)
+    return false;
+  for (auto [I, Mod] : enumerate(Modules))
+    if (Lines[2 + I] != Mod)
+      return false;
+
+  // Parse everything before adding to ImportLists so that a truncated file
+  // leaves it empty.
+  struct Entry {
+    unsigned Dest, Src;
+    GlobalValue::GUID GUID;
+    unsigned ImportType;
+  };
+  std::vector<Entry> Entries;
+  for (size_t L = 2 + NumModules; L < Lines.size();) {
+    unsigned Dest;
+    size_t Count;
+    auto [DestStr, CountStr] = Lines[L++].split(' ');
+    if (DestStr.getAsInteger(10, Dest) || Dest >= NumModules ||
+        CountStr.getAsInteger(10, Count) || Count > Lines.size() - L)
+      return false;
+    for (size_t E = L + Count; L != E; ++L) {
+      SmallVector<StringRef, 3> Fields;
+      Lines[L].split(Fields, ' ');
+      Entry Ent{Dest, 0, 0, 0};
+      if (Fields.size() != 3 || Fields[0].getAsInteger(10, Ent.Src) ||
+          Ent.Src >= NumModules || Fields[1].getAsInteger(10, Ent.GUID) ||
+          Fields[2].getAsInteger(10, Ent.ImportType) ||
+          Ent.ImportType > GlobalValueSummary::Declaration)
+        return false;
+      Entries.push_back(Ent);
+    }
+  }
+
+  for (const Entry &Ent : Entries)
+    ImportLists[Modules[Ent.Dest]].addGUID(
+        Modules[Ent.Src], Ent.GUID,
+        static_cast<GlobalValueSummary::ImportKind>(Ent.ImportType));
+  return true;
+}
+
+// Predicts the cost of running the backend on a module as the number of
+// instructions it defines and imports. Imported definitions are optimized with
+// the module, so they cost roughly as much as local ones.
+static uint64_t
+predictBackendCost(const ModuleSummaryIndex &Index,
+                   const GVSummaryMapTy &DefinedGlobals,
+                   const FunctionImporter::ImportMapTy &Imports) {
+  uint64_t Cost = 0;
+  for (const auto &[GUID, S] : DefinedGlobals)
+    if (auto *FS = dyn_cast<FunctionSummary>(S->getBaseObject()))
+      Cost += FS->instCount();
+  for (const auto &[FromModule, GUID, Kind] : Imports) {
+    if (Kind != GlobalValueSummary::Definition)
+      continue;
+    if (auto *S = Index.findSummaryInModule(GUID, FromModule))
+      if (auto *FS = dyn_cast<FunctionSummary>(S->getBaseObject()))
+        Cost += FS->instCount();
+  }
+  return Cost;
+}
+
+// Writes the backend jobs of the thin link as JSON, so that a distributed build
+// scheduler can place and prefetch them without reading the index files. The
+// instruction count is the same predictor used to order in-process backends,
+// and the size of the input bitcode bounds what a backend has to load.
+static Error emitThinLTOJobGraph(
+    const Config &Conf, const ModuleSummaryIndex &Index,
+    const MapVector<StringRef, BitcodeModule> &ModuleMap,
+    const MapVector<StringRef, BitcodeModule> &ModulesToCompile,
+    unsigned FirstTask,
+    DenseMap<StringRef, GVSummaryMapTy> &ModuleToDefinedGVSummaries,
+    const FunctionImporter::ImportListsTy &ImportLists,
+    DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists,
+    StringMap<std::map<GlobalValue::GUID, GlobalValue::LinkageTypes>>
+        &ResolvedODR) {
+  DenseSet<GlobalValue::GUID> CfiFunctionDefs, CfiFunctionDecls;
+  CfiFunctionDefs.insert_range(Index.cfiFunctionDefs().guids());
+  CfiFunctionDecls.insert_range(Index.cfiFunctionDecls().guids());
+
+  return writeToOutput(Conf.ThinLTOJobGraphFile, [&](raw_ostream &OS) {
+    json::OStream J(OS, 2);
+    J.object([&] {
+      J.attribute("version", 1);
+      J.attributeArray("jobs", [&] {
+        for (auto [I, Mod] : enumerate(ModulesToCompile)) {
+          StringRef ModulePath = Mod.first;
+          const FunctionImporter::ImportMapTy &ImportList =
+              ImportLists.lookup(ModulePath);
+          const GVSummaryMapTy &DefinedGlobals =
+              ModuleToDefinedGVSummaries[ModulePath];
+          SmallVector<StringRef, 0> Sources = ImportList.getSourceModules();
+
+          uint64_t InputBytes = Mod.second.getBuffer().size();
+          for (StringRef Source : Sources) {
+            auto It = ModuleMap.find(Source);
+            if (It != ModuleMap.end())
+              InputBytes += It->second.getBuffer().size();
+          }
+
+          J.object([&] {
+            J.attribute("task", int64_t(FirstTask + I));
+            J.attribute("module", ModulePath);
+            J.attributeArray("inputs", [&] {
+              J.value(ModulePath);
+              for (StringRef Source : Sources)
+                J.value(Source);
+            });
+            J.attribute("input_bitcode_bytes", int64_t(InputBytes));
+            J.attribute(
+                "estimated_instructions",
+                int64_t(predictBackendCost(Index, DefinedGlobals, ImportList)));
+            if (Index.modulePaths().count(ModulePath) &&
+                !all_of(Index.getModuleHash(ModulePath),
+                        [](uint32_t V) { return V == 0; }))
+              J.attribute("cache_key",
+                          computeLTOCacheKey(Conf, Index, ModulePath,
+                                             ImportList,
+                                             ExportLists[ModulePath],
+                                             ResolvedODR[ModulePath],
+                                             DefinedGlobals, CfiFunctionDefs,
+                                             CfiFunctionDecls));
+          });
+        }
+      });
+    });
+    OS << '\n';
+    return Error::success();
+  });
+}
+
 Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
                       const DenseSet<GlobalValue::GUID> &GUIDPreservedSymbols) {
   LLVM_DEBUG(dbgs() << "Running ThinLTO\n");
@@ -1974,7 +2263,7 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
                                LocalWPDTargetsMap);
 
   auto isPrevailing = [&](GlobalValue::GUID GUID, const GlobalValueSummary *S) {
-    return ThinLTO.PrevailingModuleForGUID[GUID] == S->modulePath();
+    return ThinLTO.PrevailingModuleForGUID.lookup(GUID) == S->modulePath();
   };
   if (EnableMemProfContextDisambiguation) {
     MemProfContextDisambiguation ContextDisambiguation;
@@ -2003,10 +2292,41 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
   // cross module importing, which adds to peak memory via the computed import
   // and export lists.
   releaseGlobalResolutionsMemory();
+  reportMemory("resolution", ThinLTO.CombinedIndex);
+
+  if (Conf.OptLevel > 0) {
+    // With the same inputs as an earlier link, the import lists come out the
+    // same, so reuse the ones it saved in the cache directory.
+    std::string ImportsPath;
+    SmallVector<StringRef, 0> Modules;
+    if (ThinLTOReuseImportLists && Cache.isValid()) {
+      append_range(Modules, ModuleToDefinedGVSummaries.keys());
+      llvm::sort(Modules);
+      std::string Key = computeThinLinkImportsKey(
+          Conf, ThinLTO.CombinedIndex, Modules, GUIDPreservedSymbols,
+          DynamicExportSymbols, ThinLTO.PrevailingModuleForGUID);
+      if (!Key.empty()) {
+        SmallString<128> Path(Cache.getCacheDirectoryPath());
+        sys::path::append(Path, "llvmcache-imports-" + Key);
+        ImportsPath = std::string(Path);
+      }
+    }
 
-  if (Conf.OptLevel > 0)
-    ComputeCrossModuleImport(ThinLTO.CombinedIndex, ModuleToDefinedGVSummaries,
-                             isPrevailing, ImportLists, ExportLists);
+    if (!ImportsPath.empty() &&
+        loadImportLists(ImportsPath, Modules, ImportLists)) {
+      ComputeCrossModuleExports(ThinLTO.CombinedIndex,
+                                ModuleToDefinedGVSummaries, ImportLists,
+                                ExportLists);
+    } else {
+      ComputeCrossModuleImport(ThinLTO.CombinedIndex,
+                               ModuleToDefinedGVSummaries, isPrevailing,
+                               ImportLists, ExportLists);
+      if (!ImportsPath.empty() &&
+          !sys::fs::create_directories(Cache.getCacheDirectoryPath()))
+        saveImportLists(ImportsPath, Modules, ImportLists);
+    }
+  }
+  reportMemory("import", ThinLTO.CombinedIndex);
 
   // Any functions referenced by the jump table in the regular LTO object must
   // be exported.
@@ -2040,6 +2360,7 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
   thinLTOPropagateFunctionAttrs(ThinLTO.CombinedIndex, isPrevailing);
 
   generateParamAccessSummary(ThinLTO.CombinedIndex);
+  reportMemory("thin-link", ThinLTO.CombinedIndex);
 
   if (llvm::timeTraceProfilerEnabled())
     llvm::timeTraceProfilerEnd();
@@ -2049,6 +2370,13 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
   auto &ModuleMap =
       ThinLTO.ModulesToCompile ? *ThinLTO.ModulesToCompile : ThinLTO.ModuleMap;
 
+  if (!Conf.ThinLTOJobGraphFile.empty())
+    if (Error E = emitThinLTOJobGraph(
+            Conf, ThinLTO.CombinedIndex, ThinLTO.ModuleMap, ModuleMap,
+            RegularLTO.ParallelCodeGenParallelismLevel,
+            ModuleToDefinedGVSummaries, ImportLists, ExportLists, ResolvedODR))
+      return E;
+
   auto RunBackends = [&](ThinBackendProc *BackendProcess) -> Error {
     auto ProcessOneModule = [&](int I) -> Error {
       auto &Mod = *(ModuleMap.begin() + I);
@@ -2075,19 +2403,28 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
         if (Error E = ProcessOneModule(I))
           return E;
     } else {
-      // When executing in parallel, process largest bitsize modules first to
-      // improve parallelism, and avoid starving the thread pool near the end.
-      // This saves about 15 sec on a 36-core machine while link `clang.exe`
-      // (out of 100 sec).
+      // When executing in parallel, process the most expensive modules first
+      // to improve parallelism, and avoid starving the thread pool near the
+      // end. The cost is predicted from the instruction counts in the summaries
+      // of defined and imported functions, which tracks backend time better
+      // than bitcode size does.
       std::vector<BitcodeModule *> ModulesVec;
+      std::vector<uint64_t> Costs;
       ModulesVec.reserve(ModuleMap.size());
-      for (auto &Mod : ModuleMap)
+      Costs.reserve(ModuleMap.size());
+      for (auto &Mod : ModuleMap) {
         ModulesVec.push_back(&Mod.second);
-      for (int I : generateModulesOrdering(ModulesVec))
+        Costs.push_back(predictBackendCost(
+            ThinLTO.CombinedIndex, ModuleToDefinedGVSummaries[Mod.first],
+            ImportLists.lookup(Mod.first)));
+      }
+      for (int I : generateModulesOrdering(ModulesVec, Costs))
         if (Error E = ProcessOneModule(I))
           return E;
     }
-    return BackendProcess->wait();
+    Error E = BackendProcess->wait();
+    reportMemory("backends", ThinLTO.CombinedIndex);
+    return E;
   };
 
   if (!CodeGenDataThinLTOTwoRounds) {
@@ -2191,6 +2528,19 @@ std::vector<int> lto::generateModulesOrdering(ArrayRef<BitcodeModule *> R) {
   return ModulesOrdering;
 }
 
+std::vector<int> lto::generateModulesOrdering(ArrayRef<BitcodeModule *> R,
+                                              ArrayRef<uint64_t> Costs) {
+  assert(R.size() == Costs.size());
+  auto Seq = llvm::seq<int>(0, R.size());
+  std::vector<int> ModulesOrdering(Seq.begin(), Seq.end());
+  llvm::sort(ModulesOrdering, [&](int LeftIndex, int RightIndex) {
+    if (Costs[LeftIndex] != Costs[RightIndex])
+      return Costs[LeftIndex] > Costs[RightIndex];
+    return R[LeftIndex]->getBuffer().size() > R[RightIndex]->getBuffer().size();
+  });
+  return ModulesOrdering;
+}
+
 namespace {
 /// This out-of-process backend does not perform code generation when invoked
 /// for each task. Instead, it generates the necessary information (e.g., the
@@ -34,6 +34,7 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/ToolOutputFile.h"
@@ -41,6 +42,7 @@
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/TargetParser/SubtargetFeature.h"
+#include "llvm/Transforms/IPO/GlobalDCE.h"
 #include "llvm/Transforms/IPO/WholeProgramDevirt.h"
 #include "llvm/Transforms/Utils/FunctionImportUtils.h"
 #include "llvm/Transforms/Utils/SplitModule.h"
@@ -73,6 +75,11 @@ static cl::opt<bool> ThinLTOAssumeMerged(
     cl::desc("Assume the input has already undergone ThinLTO function "
              "importing and the other pre-optimization pipeline changes."));
 
+static cl::opt<bool> ThinLTOPrefetchImports(
+    "thinlto-prefetch-imports", cl::init(true), cl::Hidden,
+    cl::desc("Read the bitcode files that a distributed ThinLTO backend "
+             "imports from concurrently, before importing"));
+
 namespace llvm {
 extern cl::opt<bool> NoPGOWarnMismatch;
 }
@@ -236,10 +243,19 @@ createTargetMachine(const Config &Conf, const Target *TheTarget, Module &M) {
   return TM;
 }
 
-static void runNewPMPasses(const Config &Conf, Module &Mod, TargetMachine *TM,
-                           unsigned OptLevel, bool IsThinLTO,
-                           ModuleSummaryIndex *ExportSummary,
-                           const ModuleSummaryIndex *ImportSummary) {
+namespace {
+// The part of the regular LTO pipeline to run on a module. With
+// Config::ParallelRegularLTOOpt, only the passes that need the whole program
+// run on the merged module, and the rest run on each code generation partition.
+enum class RegularLTOPipeline { Full, WholeProgram, Partition };
+} // namespace
+
+static void
+runNewPMPasses(const Config &Conf, Module &Mod, TargetMachine *TM,
+               unsigned OptLevel, bool IsThinLTO,
+               ModuleSummaryIndex *ExportSummary,
+               const ModuleSummaryIndex *ImportSummary,
+               RegularLTOPipeline Pipeline = RegularLTOPipeline::Full) {
   auto FS = vfs::getRealFileSystem();
   std::optional<PGOOptions> PGOOpt;
   if (!Conf.SampleProfile.empty())
@@ -332,8 +348,17 @@ static void runNewPMPasses(const Config &Conf, Module &Mod, TargetMachine *TM,
       report_fatal_error(Twine("unable to parse pass pipeline description '") +
                          Conf.OptPipeline + "': " + toString(std::move(Err)));
     }
-  } else if (IsThinLTO) {
+  } else if (IsThinLTO || Pipeline == RegularLTOPipeline::Partition) {
+    // A partition has no whole-program work left, like a ThinLTO backend
+    // that imports nothing.
     MPM.addPass(PB.buildThinLTODefaultPipeline(OL, ImportSummary));
+  } else if (Pipeline == RegularLTOPipeline::WholeProgram) {
+    // The O0 pipeline is the part that has to see the whole program: WPD,
+    // type test lowering and CFI. Drop what became unreferenced before the
+    // module is split.
+    MPM.addPass(
+        PB.buildLTODefaultPipeline(OptimizationLevel::O0, ExportSummary));
+    MPM.addPass(GlobalDCEPass(/*InLTOPostLink=*/true));
   } else {
     MPM.addPass(PB.buildLTODefaultPipeline(OL, ExportSummary));
   }
@@ -362,10 +387,12 @@ static bool isEmptyModule(const Module &Mod) {
          Mod.getModuleInlineAsm().empty();
 }
 
-bool lto::opt(const Config &Conf, TargetMachine *TM, unsigned Task, Module &Mod,
-              bool IsThinLTO, ModuleSummaryIndex *ExportSummary,
-              const ModuleSummaryIndex *ImportSummary,
-              const std::vector<uint8_t> &CmdArgs) {
+static bool runOpt(const Config &Conf, TargetMachine *TM, unsigned Task,
+                   Module &Mod, bool IsThinLTO,
+                   ModuleSummaryIndex *ExportSummary,
+                   const ModuleSummaryIndex *ImportSummary,
+                   const std::vector<uint8_t> &CmdArgs,
+                   RegularLTOPipeline Pipeline) {
   if (EmbedBitcode == LTOBitcodeEmbedding::EmbedPostMergePreOptimized) {
     // FIXME: the motivation for capturing post-merge bitcode and command line
     // is replicating the compilation environment from bitcode, without needing
@@ -391,11 +418,19 @@ bool lto::opt(const Config &Conf, TargetMachine *TM, unsigned Task, Module &Mod,
   if (!isEmptyModule(Mod)) {
     // FIXME: Plumb the combined index into the new pass manager.
     runNewPMPasses(Conf, Mod, TM, Conf.OptLevel, IsThinLTO, ExportSummary,
-                   ImportSummary);
+                   ImportSummary, Pipeline);
   }
   return !Conf.PostOptModuleHook || Conf.PostOptModuleHook(Task, Mod);
 }
 
+bool lto::opt(const Config &Conf, TargetMachine *TM, unsigned Task, Module &Mod,
+              bool IsThinLTO, ModuleSummaryIndex *ExportSummary,
+              const ModuleSummaryIndex *ImportSummary,
+              const std::vector<uint8_t> &CmdArgs) {
+  return runOpt(Conf, TM, Task, Mod, IsThinLTO, ExportSummary, ImportSummary,
+                CmdArgs, RegularLTOPipeline::Full);
+}
+
 static void codegen(const Config &Conf, TargetMachine *TM,
                     AddStreamFn AddStream, unsigned Task, Module &Mod,
                     const ModuleSummaryIndex &CombinedIndex) {
@@ -472,7 +507,8 @@ static void codegen(const Config &Conf, TargetMachine *TM,
 static void splitCodeGen(const Config &C, TargetMachine *TM,
                          AddStreamFn AddStream,
                          unsigned ParallelCodeGenParallelismLevel, Module &Mod,
-                         const ModuleSummaryIndex &CombinedIndex) {
+                         const ModuleSummaryIndex &CombinedIndex,
+                         bool OptimizePartitions) {
   DefaultThreadPool CodegenThreadPool(
       heavyweight_hardware_concurrency(ParallelCodeGenParallelismLevel));
   unsigned ThreadCount = 0;
@@ -503,6 +539,12 @@ static void splitCodeGen(const Config &C, TargetMachine *TM,
               std::unique_ptr<TargetMachine> TM =
                   createTargetMachine(C, T, *MPartInCtx);
 
+              if (OptimizePartitions && !isEmptyModule(*MPartInCtx))
+                runNewPMPasses(C, *MPartInCtx, TM.get(), C.OptLevel,
+                               /*IsThinLTO=*/false, /*ExportSummary=*/nullptr,
+                               /*ImportSummary=*/nullptr,
+                               RegularLTOPipeline::Partition);
+
               codegen(C, TM.get(), AddStream, ThreadId, *MPartInCtx,
                       CombinedIndex);
             },
@@ -559,10 +601,15 @@ Error lto::backend(const Config &C, AddStreamFn AddStream,
   std::unique_ptr<TargetMachine> TM = createTargetMachine(C, *TOrErr, Mod);
 
   LLVM_DEBUG(dbgs() << "Running regular LTO\n");
+  bool OptimizePartitions = C.ParallelRegularLTOOpt && !C.CodeGenOnly &&
+                            ParallelCodeGenParallelismLevel > 1 &&
+                            C.OptLevel > 0 && C.OptPipeline.empty();
   if (!C.CodeGenOnly) {
-    if (!opt(C, TM.get(), 0, Mod, /*IsThinLTO=*/false,
-             /*ExportSummary=*/&CombinedIndex, /*ImportSummary=*/nullptr,
-             /*CmdArgs*/ std::vector<uint8_t>()))
+    if (!runOpt(C, TM.get(), 0, Mod, /*IsThinLTO=*/false,
+                /*ExportSummary=*/&CombinedIndex, /*ImportSummary=*/nullptr,
+                /*CmdArgs*/ std::vector<uint8_t>(),
+                OptimizePartitions ? RegularLTOPipeline::WholeProgram
+                                   : RegularLTOPipeline::Full))
       return Error::success();
   }
 
@@ -570,7 +617,7 @@ Error lto::backend(const Config &C, AddStreamFn AddStream,
     codegen(C, TM.get(), AddStream, 0, Mod, CombinedIndex);
   } else {
     splitCodeGen(C, TM.get(), AddStream, ParallelCodeGenParallelismLevel, Mod,
-                 CombinedIndex);
+                 CombinedIndex, OptimizePartitions);
   }
   return Error::success();
 }
@@ -678,6 +725,28 @@ Error lto::thinBackend(const Config &Conf, unsigned Task, AddStreamFn AddStream,
       !Conf.PostInternalizeModuleHook(Task, Mod))
     return finalizeOptimizationRemarks(std::move(DiagnosticOutputFile));
 
+  // Without a module map the import sources are read from disk. Parsing has to
+  // stay serial because all sources share the destination's LLVMContext, but
+  // the reads do not, so issue them all up front instead of one per source.
+  // The files are read rather than mapped, since a mapping would defer the I/O
+  // to the serial parse. A failed read is retried, and reported, by the loader
+  // below.
+  StringMap<std::unique_ptr<MemoryBuffer>> PrefetchedSources;
+  if (!ModuleMap && ThinLTOPrefetchImports) {
+    SmallVector<StringRef, 0> Sources = ImportList.getSourceModules();
+    std::vector<std::unique_ptr<MemoryBuffer>> Buffers(Sources.size());
+    parallelFor(0, Sources.size(), [&](size_t I) {
+      if (ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr =
+              MemoryBuffer::getFile(Sources[I], /*IsText=*/false,
+                                    /*RequiresNullTerminator=*/false,
+                                    /*IsVolatile=*/true))
+        Buffers[I] = std::move(*MBOrErr);
+    });
+    for (auto [Source, Buffer] : zip(Sources, Buffers))
+      if (Buffer)
+        PrefetchedSources[Source] = std::move(Buffer);
+  }
+
   auto ModuleLoader = [&](StringRef Identifier) {
     assert(Mod.getContext().isODRUniquingDebugTypes() &&
            "ODR Type uniquing should be enabled on the context");
@@ -689,8 +758,12 @@ Error lto::thinBackend(const Config &Conf, unsigned Task, AddStreamFn AddStream,
                                      /*IsImporting*/ true);
     }
 
-    ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> MBOrErr =
-        llvm::MemoryBuffer::getFile(Identifier);
+    ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> MBOrErr = nullptr;
+    auto It = PrefetchedSources.find(Identifier);
+    if (It != PrefetchedSources.end())
+      MBOrErr = std::move(It->second);
+    else
+      MBOrErr = llvm::MemoryBuffer::getFile(Identifier);
     if (!MBOrErr)
       return Expected<std::unique_ptr<llvm::Module>>(make_error<StringError>(
           Twine("Error loading imported file ") + Identifier + " : ",
@@ -93,6 +93,7 @@ void MCAssembler::reset() {
   HasFinalLayout = false;
   RelaxAll = false;
   Sections.clear();
+  RelaxableSections.clear();
   Symbols.clear();
   ThumbFuncs.clear();
   BundleAlignSize = 0;
@@ -811,6 +812,25 @@ void MCAssembler::writeSectionData(raw_ostream &OS,
          OS.tell() - Start == getSectionAddressSize(*Sec));
 }
 
+// Whether relaxFragment can change the size of \p F. Keep in sync with
+// relaxFragment.
+static bool mayRelax(const MCFragment &F) {
+  switch (F.getKind()) {
+  default:
+    return false;
+  case MCFragment::FT_Relaxable:
+  case MCFragment::FT_Dwarf:
+  case MCFragment::FT_DwarfFrame:
+  case MCFragment::FT_LEB:
+  case MCFragment::FT_BoundaryAlign:
+  case MCFragment::FT_CVInlineLines:
+  case MCFragment::FT_CVDefRange:
+  case MCFragment::FT_Fill:
+  case MCFragment::FT_PseudoProbe:
+    return true;
+  }
+}
+
 void MCAssembler::layout() {
   assert(getBackendPtr() && "Expected assembler backend");
   DEBUG_WITH_TYPE("mc-dump-pre", {
@@ -844,8 +864,16 @@ void MCAssembler::layout() {
 
   // Layout until everything fits.
   this->HasLayout = true;
-  for (MCSection &Sec : *this)
+  RelaxableSections.clear();
+  for (MCSection &Sec : *this) {
     layoutSection(Sec);
+    for (MCFragment &F : Sec) {
+      if (mayRelax(F)) {
+        RelaxableSections.push_back(&Sec);
+        break;
+      }
+    }
+  }
   while (relaxOnce())
     if (getContext().hadError())
       return;
@@ -1234,21 +1262,23 @@ bool MCAssembler::relaxOnce() {
   // Size of fragments in one section can depend on the size of fragments in
   // another. If any fragment has changed size, we have to re-layout (and
   // as a result possibly further relax) all sections.
+  // Sections without relaxable fragments keep their initial layout and are
+  // skipped.
   bool ChangedAny = false;
-  for (MCSection &Sec : *this) {
+  for (MCSection *Sec : RelaxableSections) {
     // Assume each iteration finalizes at least one extra fragment. If the
     // layout does not converge after N+1 iterations, bail out.
-    auto MaxIter = Sec.curFragList()->Tail->getLayoutOrder() + 1;
+    auto MaxIter = Sec->curFragList()->Tail->getLayoutOrder() + 1;
     for (;;) {
       bool Changed = false;
-      for (MCFragment &F : Sec)
+      for (MCFragment &F : *Sec)
         if (relaxFragment(F))
           Changed = true;
 
       ChangedAny |= Changed;
       if (!Changed || --MaxIter == 0)
         break;
-      layoutSection(Sec);
+      layoutSection(*Sec);
     }
   }
   return ChangedAny;
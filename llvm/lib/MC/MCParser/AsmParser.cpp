@@ -756,6 +756,17 @@ extern MCAsmParserExtension *createWasmAsmParser();
 
 } // end namespace llvm
 
+/// Return \p S in lower case. Compiler-generated assembly spells directives
+/// and mnemonics in lower case already, so only copy into \p Buf when there
+/// is something to convert; this is done once per statement.
+static StringRef toLowerIfNeeded(StringRef S, SmallVectorImpl<char> &Buf) {
+  if (llvm::none_of(S, isUpper))
+    return S;
+  Buf.resize(S.size());
+  llvm::transform(S, Buf.begin(), toLower);
+  return StringRef(Buf.data(), Buf.size());
+}
+
 AsmParser::AsmParser(SourceMgr &SM, MCContext &Ctx, MCStreamer &Out,
                      const MCAsmInfo &MAI, unsigned CB = 0)
     : MCAsmParser(Ctx, Out, SM, MAI), CurBuffer(CB ? CB : SM.getMainFileID()),
@@ -1772,8 +1783,9 @@ bool AsmParser::parseStatement(ParseStatementInfo &Info,
   // Handle conditional assembly here before checking for skipping.  We
   // have to do this so that .endif isn't skipped in a ".if 0" block for
   // example.
+  SmallString<32> LowerIDVal;
   StringMap<DirectiveKind>::const_iterator DirKindIt =
-      DirectiveKindMap.find(IDVal.lower());
+      DirectiveKindMap.find(toLowerIfNeeded(IDVal, LowerIDVal));
   DirectiveKind DirKind = (DirKindIt == DirectiveKindMap.end())
                               ? DK_NO_DIRECTIVE
                               : DirKindIt->getValue();
@@ -2246,7 +2258,8 @@ bool AsmParser::parseAndMatchAndEmitTargetInstruction(ParseStatementInfo &Info,
                                                       AsmToken ID,
                                                       SMLoc IDLoc) {
   // Canonicalize the opcode to lower case.
-  std::string OpcodeStr = IDVal.lower();
+  SmallString<32> LowerOpcode;
+  StringRef OpcodeStr = toLowerIfNeeded(IDVal, LowerOpcode);
   ParseInstructionInfo IInfo(Info.AsmRewrites);
   bool ParseHadError = getTargetParser().parseInstruction(IInfo, OpcodeStr, ID,
                                                           Info.ParsedOperands);
@@ -600,21 +600,6 @@ InstrBuilder::createInstrDescImpl(const MCInst &MCI,
   ID->SchedClassID = SchedClassID;
 
   bool IsCall = MCIA->isCall(MCI);
-  if (IsCall && FirstCallInst) {
-    // We don't correctly model calls.
-    WithColor::warning() << "found a call in the input assembly sequence.\n";
-    WithColor::note() << "call instructions are not correctly modeled. "
-                      << "Assume a latency of " << CallLatency << "cy.\n";
-    FirstCallInst = false;
-  }
-
-  if (MCIA->isReturn(MCI) && FirstReturnInst) {
-    WithColor::warning() << "found a return instruction in the input"
-                         << " assembly sequence.\n";
-    WithColor::note() << "program counter updates are ignored.\n";
-    FirstReturnInst = false;
-  }
-
   initializeUsedResources(*ID, SCDesc, STI, ProcResourceMasks);
   computeMaxLatency(*ID, SCDesc, STI, CallLatency, IsCall);
 
@@ -680,6 +665,24 @@ InstrBuilder::createInstruction(const MCInst &MCI,
   if (!DescOrErr)
     return DescOrErr.takeError();
   const InstrDesc &D = *DescOrErr;
+
+  // Descriptors outlive a sequence, so check for the instructions we warn
+  // about here rather than when the descriptor is created.
+  if (FirstCallInst && MCIA->isCall(MCI)) {
+    // We don't correctly model calls.
+    WithColor::warning() << "found a call in the input assembly sequence.\n";
+    WithColor::note() << "call instructions are not correctly modeled. "
+                      << "Assume a latency of " << CallLatency << "cy.\n";
+    FirstCallInst = false;
+  }
+
+  if (FirstReturnInst && MCIA->isReturn(MCI)) {
+    WithColor::warning() << "found a return instruction in the input"
+                         << " assembly sequence.\n";
+    WithColor::note() << "program counter updates are ignored.\n";
+    FirstReturnInst = false;
+  }
+
   Instruction *NewIS = nullptr;
   std::unique_ptr<Instruction> CreatedIS;
   bool IsInstRecycled = false;
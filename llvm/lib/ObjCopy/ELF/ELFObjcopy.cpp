@@ -28,12 +28,14 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/Memory.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -216,6 +218,7 @@ Error Object::compressOrDecompressSections(const CommonConfig &Config) {
   // because it would mutate the sections array.
   SmallVector<std::pair<SectionBase *, std::function<SectionBase *()>>, 0>
       ToReplace;
+  SmallVector<std::pair<SectionBase *, DebugCompressionType>, 0> ToCompress;
   for (SectionBase &Sec : sections()) {
     std::optional<DebugCompressionType> CType;
     for (auto &[Matcher, T] : Config.compressSections)
@@ -243,16 +246,24 @@ Error Object::compressOrDecompressSections(const CommonConfig &Config) {
         ToReplace.emplace_back(
             &Sec, [=] { return &addSection<DecompressedSection>(*CS); });
     } else if (*CType != DebugCompressionType::None) {
-      ToReplace.emplace_back(&Sec, [=, S = &Sec] {
-        return &addSection<CompressedSection>(
-            CompressedSection(*S, *CType, Is64Bits));
-      });
+      ToCompress.emplace_back(&Sec, *CType);
     }
   }
 
+  // Compression takes most of the time here and every section is compressed
+  // independently, so do that in parallel. Adding the results to the section
+  // list is done afterwards in order.
+  std::vector<std::optional<CompressedSection>> Compressed(ToCompress.size());
+  parallelFor(0, ToCompress.size(), [&](size_t I) {
+    Compressed[I].emplace(*ToCompress[I].first, ToCompress[I].second,
+                          Is64Bits);
+  });
+
   DenseMap<SectionBase *, SectionBase *> FromTo;
   for (auto [S, Func] : ToReplace)
     FromTo[S] = Func();
+  for (auto [Sec, C] : zip_equal(ToCompress, Compressed))
+    FromTo[Sec.first] = &addSection<CompressedSection>(std::move(*C));
   return replaceSections(FromTo);
 }
 
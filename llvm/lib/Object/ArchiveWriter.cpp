@@ -31,6 +31,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SmallVectorMemoryBuffer.h"
 #include "llvm/Support/raw_ostream.h"
@@ -846,15 +847,54 @@ computeMemberData(raw_ostream &StringTable, raw_ostream &SymNames,
   std::vector<std::unique_ptr<SymbolicFile>> SymFiles;
 
   if (NeedSymbols != SymtabWritingMode::NoSymtab || isAIXBigArchive(Kind)) {
-    for (const NewArchiveMember &M : NewMembers) {
+    SymFiles.resize(NewMembers.size());
+    auto IsBitcode = [&](const NewArchiveMember &M) {
+      return identify_magic(M.Buf->getBuffer()) == file_magic::bitcode;
+    };
+    auto ReadMember = [&](size_t I,
+                          function_ref<void(Error)> MemberWarn) -> Error {
+      const NewArchiveMember &M = NewMembers[I];
       Expected<std::unique_ptr<SymbolicFile>> SymFileOrErr = getSymbolicFile(
           M.Buf->getMemBufferRef(), Context, Kind, [&](Error Err) {
-            Warn(createFileError(M.MemberName, std::move(Err)));
+            MemberWarn(createFileError(M.MemberName, std::move(Err)));
           });
       if (!SymFileOrErr)
         return createFileError(M.MemberName, SymFileOrErr.takeError());
-      SymFiles.push_back(std::move(*SymFileOrErr));
+      SymFiles[I] = std::move(*SymFileOrErr);
+      return Error::success();
+    };
+
+    // Reading the symbols of an object file only touches its own buffer, so
+    // large archives are read in parallel. Bitcode files share Context, which
+    // is not thread-safe, and are read one at a time afterwards. So that the
+    // diagnostics don't depend on scheduling, each member's error and warnings
+    // are kept and reported in member order, stopping at the first error.
+    std::vector<std::optional<Error>> MemberErrors(NewMembers.size());
+    std::vector<std::vector<Error>> MemberWarnings(NewMembers.size());
+    parallelFor(0, NewMembers.size(), [&](size_t I) {
+      if (!IsBitcode(NewMembers[I]))
+        MemberErrors[I].emplace(ReadMember(I, [&](Error Err) {
+          MemberWarnings[I].push_back(std::move(Err));
+        }));
+    });
+    Error FirstErr = Error::success();
+    for (size_t I = 0, E = NewMembers.size(); I != E; ++I) {
+      if (FirstErr) {
+        // Discard the diagnostics of the members after the first error.
+        for (Error &W : MemberWarnings[I])
+          consumeError(std::move(W));
+        if (MemberErrors[I])
+          consumeError(std::move(*MemberErrors[I]));
+        continue;
+      }
+      for (Error &W : MemberWarnings[I])
+        Warn(std::move(W));
+      if (!MemberErrors[I])
+        MemberErrors[I].emplace(ReadMember(I, Warn));
+      FirstErr = std::move(*MemberErrors[I]);
     }
+    if (FirstErr)
+      return std::move(FirstErr);
   }
 
   if (SymMap) {
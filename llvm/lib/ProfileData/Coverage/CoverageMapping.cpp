@@ -1452,6 +1452,12 @@ CoverageData CoverageMapping::getCoverageForFile(StringRef Filename) const {
   // the filename, we may get back some records that are not in the file.
   ArrayRef<unsigned> RecordIndices =
       getImpreciseRecordIndicesForFilename(Filename);
+  // Size the region buffer up front; for large files it would otherwise be
+  // regrown many times while collecting every function's regions.
+  size_t NumRegions = 0;
+  for (unsigned RecordIndex : RecordIndices)
+    NumRegions += Functions[RecordIndex].CountedRegions.size();
+  Regions.reserve(NumRegions);
   for (unsigned RecordIndex : RecordIndices) {
     const FunctionRecord &Function = Functions[RecordIndex];
     auto MainFileID = findMainViewFileID(Filename, Function);
@@ -923,18 +923,22 @@ std::error_code SampleProfileReaderExtBinaryBase::readFuncProfiles(
       if (!useMD5())
         FNameString = FName.stringRef();
 
+      // Contexts are in preorder, so once we step out of the common
+      // ancestor's subtree none of the remaining contexts can be in it.
+      // Dropping it here saves a prefix comparison per remaining context.
+      if (CommonContext && !CommonContext->isPrefixOf(FContext))
+        CommonContext = nullptr;
+
       // For function in the current module, keep its farthest ancestor
       // context. This can be used to load itself and its child and
       // sibling contexts.
-      if ((useMD5() && FuncGuidsToUse.count(FName.getHashCode())) ||
-          (!useMD5() && (FuncsToUse.count(FNameString) ||
-                         (Remapper && Remapper->exist(FNameString))))) {
-        if (!CommonContext || !CommonContext->isPrefixOf(FContext))
-          CommonContext = &FContext;
-      }
+      if (!CommonContext &&
+          ((useMD5() && FuncGuidsToUse.count(FName.getHashCode())) ||
+           (!useMD5() && (FuncsToUse.count(FNameString) ||
+                          (Remapper && Remapper->exist(FNameString))))))
+        CommonContext = &FContext;
 
-      if (CommonContext == &FContext ||
-          (CommonContext && CommonContext->isPrefixOf(FContext))) {
+      if (CommonContext) {
         // Load profile for the current context which originated from
         // the common ancestor.
         const uint8_t *FuncProfileAddr = Start + NameOffset.second;
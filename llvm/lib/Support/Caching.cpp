@@ -9,14 +9,19 @@
 // This file implements the localCache function, which simplifies creating,
 // adding to, and querying a local file system cache. localCache takes care of
 // periodically pruning older files from the cache using a CachePruningPolicy.
+// It also implements remoteCache, which layers a shared content-addressed store
+// on top of a local cache.
 //
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/Caching.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/ThreadPool.h"
+#include <mutex>
 
 #if !defined(_MSC_VER) && !defined(__MINGW32__)
 #include <unistd.h>
@@ -26,6 +31,16 @@
 
 using namespace llvm;
 
+/// Returns the path of the entry for \p Key in \p CacheDirectoryPath. This
+/// choice of file name allows the cache to be pruned (see pruneCache() in
+/// include/llvm/Support/CachePruning.h).
+static SmallString<64> getCacheEntryPath(StringRef CacheDirectoryPath,
+                                         StringRef Key) {
+  SmallString<64> EntryPath;
+  sys::path::append(EntryPath, CacheDirectoryPath, "llvmcache-" + Key);
+  return EntryPath;
+}
+
 Expected<FileCache> llvm::localCache(const Twine &CacheNameRef,
                                      const Twine &TempFilePrefixRef,
                                      const Twine &CacheDirectoryPathRef,
@@ -39,10 +54,7 @@ Expected<FileCache> llvm::localCache(const Twine &CacheNameRef,
 
   auto Func = [=](unsigned Task, StringRef Key,
                   const Twine &ModuleName) -> Expected<AddStreamFn> {
-    // This choice of file name allows the cache to be pruned (see pruneCache()
-    // in include/llvm/Support/CachePruning.h).
-    SmallString<64> EntryPath;
-    sys::path::append(EntryPath, CacheDirectoryPath, "llvmcache-" + Key);
+    SmallString<64> EntryPath = getCacheEntryPath(CacheDirectoryPath, Key);
     // First, see if we have a cache hit.
     SmallString<64> ResultPath;
     Expected<sys::fs::file_t> FDOrErr = sys::fs::openNativeFileForRead(
@@ -174,3 +186,155 @@ Expected<FileCache> llvm::localCache(const Twine &CacheNameRef,
   };
   return FileCache(Func, CacheDirectoryPathRef.str());
 }
+
+RemoteCacheStore::~RemoteCacheStore() = default;
+
+namespace {
+// State shared by all copies of the functions returned by remoteCache().
+struct RemoteCacheState {
+  using FetchResult = std::shared_ptr<MemoryBuffer>;
+
+  std::shared_ptr<RemoteCacheStore> Store;
+  std::mutex Mu;
+  StringMap<std::shared_future<FetchResult>> Prefetched;
+  // Declared last so that the pool is joined before the rest of the state is
+  // destroyed.
+  DefaultThreadPool Pool;
+
+  RemoteCacheState(std::shared_ptr<RemoteCacheStore> Store, unsigned Threads)
+      : Store(std::move(Store)), Pool(hardware_concurrency(Threads)) {}
+
+  // The store is only an accelerator, so any error is treated as a miss.
+  FetchResult fetch(StringRef Key) {
+    Expected<std::unique_ptr<MemoryBuffer>> MBOrErr = Store->get(Key);
+    if (!MBOrErr) {
+      consumeError(MBOrErr.takeError());
+      return nullptr;
+    }
+    return FetchResult(std::move(*MBOrErr));
+  }
+
+  void prefetch(StringRef Key) {
+    std::lock_guard<std::mutex> Lock(Mu);
+    auto [It, Inserted] = Prefetched.try_emplace(Key);
+    if (Inserted)
+      It->second = Pool.async([this, K = Key.str()] { return fetch(K); });
+  }
+
+  // Drops the result of an earlier prefetch of Key, if any.
+  void discard(StringRef Key) {
+    std::lock_guard<std::mutex> Lock(Mu);
+    Prefetched.erase(Key);
+  }
+
+  // Returns the result of an earlier prefetch of Key, or fetches it now.
+  FetchResult take(StringRef Key) {
+    std::shared_future<FetchResult> Future;
+    {
+      std::lock_guard<std::mutex> Lock(Mu);
+      auto It = Prefetched.find(Key);
+      if (It != Prefetched.end()) {
+        Future = std::move(It->second);
+        Prefetched.erase(It);
+      }
+    }
+    if (Future.valid())
+      return Future.get();
+    return fetch(Key);
+  }
+
+  void writeBack(std::string Key, std::string Path) {
+    Pool.async([this, Key = std::move(Key), Path = std::move(Path)] {
+      ErrorOr<std::unique_ptr<MemoryBuffer>> MBOrErr =
+          MemoryBuffer::getFile(Path, /*IsText=*/false,
+                                /*RequiresNullTerminator=*/false);
+      // The entry may already have been pruned from the local cache.
+      if (!MBOrErr)
+        return;
+      consumeError(Store->put(Key, (*MBOrErr)->getBuffer()));
+    });
+  }
+};
+
+// Wraps a stream created by the local cache, and once the local entry has been
+// committed, uploads it to the remote store.
+struct WriteBackStream : CachedFileStream {
+  std::unique_ptr<CachedFileStream> Local;
+  std::shared_ptr<RemoteCacheState> State;
+  std::string Key;
+
+  WriteBackStream(std::unique_ptr<CachedFileStream> Local,
+                  std::shared_ptr<RemoteCacheState> State, std::string Key)
+      : CachedFileStream(std::move(Local->OS), Local->ObjectPathName),
+        Local(std::move(Local)), State(std::move(State)), Key(std::move(Key)) {}
+
+  Error commit() override {
+    if (Error E = CachedFileStream::commit())
+      return E;
+    OS.reset();
+    if (Error E = Local->commit())
+      return E;
+    State->writeBack(std::move(Key), ObjectPathName);
+    return Error::success();
+  }
+};
+} // namespace
+
+Expected<FileCache> llvm::remoteCache(const Twine &CacheNameRef,
+                                      const Twine &TempFilePrefixRef,
+                                      const Twine &CacheDirectoryPathRef,
+                                      std::shared_ptr<RemoteCacheStore> Store,
+                                      unsigned MaxFetchThreads,
+                                      AddBufferFn AddBuffer) {
+  Expected<FileCache> LocalOrErr = localCache(
+      CacheNameRef, TempFilePrefixRef, CacheDirectoryPathRef, AddBuffer);
+  if (!LocalOrErr)
+    return LocalOrErr.takeError();
+
+  FileCache Local = std::move(*LocalOrErr);
+  std::string CacheDirectoryPath = CacheDirectoryPathRef.str();
+  auto State =
+      std::make_shared<RemoteCacheState>(std::move(Store), MaxFetchThreads);
+
+  auto Func = [=](unsigned Task, StringRef Key,
+                  const Twine &ModuleName) mutable -> Expected<AddStreamFn> {
+    Expected<AddStreamFn> AddStreamOrErr = Local(Task, Key, ModuleName);
+    if (!AddStreamOrErr)
+      return AddStreamOrErr;
+    // The entry may have reached the local cache after it was prefetched.
+    if (!*AddStreamOrErr) {
+      State->discard(Key);
+      return AddStreamOrErr;
+    }
+    AddStreamFn AddStream = std::move(*AddStreamOrErr);
+
+    // On a remote hit, populate the local cache and let it add the buffer to
+    // the link.
+    if (RemoteCacheState::FetchResult MB = State->take(Key)) {
+      Expected<std::unique_ptr<CachedFileStream>> StreamOrErr =
+          AddStream(Task, ModuleName);
+      if (!StreamOrErr)
+        return StreamOrErr.takeError();
+      *(*StreamOrErr)->OS << MB->getBuffer();
+      if (Error E = (*StreamOrErr)->commit())
+        return std::move(E);
+      return AddStreamFn();
+    }
+
+    return [=, Key = Key.str()](size_t Task, const Twine &ModuleName)
+               -> Expected<std::unique_ptr<CachedFileStream>> {
+      Expected<std::unique_ptr<CachedFileStream>> StreamOrErr =
+          AddStream(Task, ModuleName);
+      if (!StreamOrErr)
+        return StreamOrErr.takeError();
+      return std::make_unique<WriteBackStream>(std::move(*StreamOrErr), State,
+                                               Key);
+    };
+  };
+  auto Prefetch = [State, CacheDirectoryPath](StringRef Key) {
+    // Lookups that will hit the local cache don't need the store.
+    if (!sys::fs::exists(getCacheEntryPath(CacheDirectoryPath, Key)))
+      State->prefetch(Key);
+  };
+  return FileCache(Func, CacheDirectoryPath, Prefetch);
+}
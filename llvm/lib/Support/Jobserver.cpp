@@ -0,0 +1,106 @@
+//===- llvm/Support/Jobserver.cpp - Jobserver Client ----------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the operating system independent parts of the
+// jobserver client: finding out from MAKEFLAGS which jobserver to talk to.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/Jobserver.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Config/llvm-config.h"
+
+#include <cstdlib>
+#include <string>
+
+using namespace llvm;
+
+JobserverClient::~JobserverClient() = default;
+
+namespace {
+/// The jobserver named by MAKEFLAGS.
+struct JobserverConfig {
+  enum { None, Fifo, Pipe } Kind = None;
+  /// The path of the named fifo, for Fifo.
+  std::string FifoPath;
+  /// The inherited file descriptors, for Pipe.
+  int ReadFD = -1;
+  int WriteFD = -1;
+  /// The "-j" count, or 0 if there was none.
+  unsigned NumJobs = 0;
+};
+} // namespace
+
+static JobserverConfig parseMakeFlags(StringRef MakeFlags) {
+  JobserverConfig Config;
+  SmallVector<StringRef, 8> Args;
+  MakeFlags.split(Args, ' ', /*MaxSplit=*/-1, /*KeepEmpty=*/false);
+  // When an option is repeated, the last one wins, as it does for make.
+  for (StringRef Arg : Args) {
+    if (Arg.consume_front("-j")) {
+      unsigned NumJobs;
+      if (!Arg.getAsInteger(10, NumJobs))
+        Config.NumJobs = NumJobs;
+      continue;
+    }
+
+    // GNU make before 4.2 spells the option --jobserver-fds.
+    if (!Arg.consume_front("--jobserver-auth=") &&
+        !Arg.consume_front("--jobserver-fds="))
+      continue;
+
+    if (Arg.consume_front("fifo:")) {
+      Config.Kind = JobserverConfig::Fifo;
+      Config.FifoPath = Arg.str();
+      continue;
+    }
+
+    // Anything else must be a "R,W" pair of file descriptors. make passes
+    // negative values when it did not give this process access to them.
+    auto [ReadStr, WriteStr] = Arg.split(',');
+    int ReadFD, WriteFD;
+    if (ReadStr.getAsInteger(10, ReadFD) ||
+        WriteStr.getAsInteger(10, WriteFD) || ReadFD < 0 || WriteFD < 0) {
+      Config.Kind = JobserverConfig::None;
+      continue;
+    }
+    Config.Kind = JobserverConfig::Pipe;
+    Config.ReadFD = ReadFD;
+    Config.WriteFD = WriteFD;
+  }
+  return Config;
+}
+
+// Include the platform-specific parts of this class.
+#ifdef LLVM_ON_UNIX
+#include "Unix/Jobserver.inc"
+#else
+static std::unique_ptr<JobserverClient>
+createPlatformClient(const JobserverConfig &) {
+  // GNU make on Windows hands out tokens through a named semaphore, which is
+  // not supported yet.
+  return nullptr;
+}
+#endif
+
+std::unique_ptr<JobserverClient> JobserverClient::create(StringRef MakeFlags) {
+  JobserverConfig Config = parseMakeFlags(MakeFlags);
+  if (Config.Kind == JobserverConfig::None)
+    return nullptr;
+  return createPlatformClient(Config);
+}
+
+JobserverClient *JobserverClient::getInstance() {
+  // Leaked on purpose: thread pools that are themselves static objects may
+  // still give back slots while static destructors run.
+  static JobserverClient *Instance = [] {
+    const char *MakeFlags = std::getenv("MAKEFLAGS");
+    return MakeFlags ? create(MakeFlags).release() : nullptr;
+  }();
+  return Instance;
+}
@@ -14,10 +14,15 @@
 
 #include "llvm/Config/llvm-config.h"
 
+#include "llvm/ADT/ScopeExit.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/Threading.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 using namespace llvm;
 
 ThreadPoolInterface::~ThreadPoolInterface() = default;
@@ -33,7 +38,10 @@ ThreadPoolInterface::~ThreadPoolInterface() = default;
 #if LLVM_ENABLE_THREADS
 
 StdThreadPool::StdThreadPool(ThreadPoolStrategy S)
-    : Strategy(S), MaxThreadCount(S.compute_thread_count()) {}
+    : Strategy(S), MaxThreadCount(S.compute_thread_count()) {
+  if (Strategy.UseJobserver)
+    TheJobserver = JobserverClient::getInstance();
+}
 
 void StdThreadPool::grow(int requested) {
   llvm::sys::ScopedWriter LockGuard(ThreadsLock);
@@ -56,13 +64,57 @@ static LLVM_THREAD_LOCAL std::vector<ThreadPoolTaskGroup *>
     *CurrentThreadTaskGroups = nullptr;
 #endif
 
+JobSlot StdThreadPool::acquireJobSlot(JobserverClient &Jobserver) {
+  // Tokens come back from other processes at unpredictable times, and the
+  // jobserver cannot be waited on together with QueueCondition, so poll it
+  // with a bounded backoff.
+  constexpr std::chrono::microseconds MaxBackoff(10000);
+  std::chrono::microseconds Backoff(50);
+  while (true) {
+    {
+      // Only ask for a slot when there is work, so idle threads hold none.
+      std::unique_lock<std::mutex> LockGuard(QueueLock);
+      QueueCondition.wait(LockGuard,
+                          [&] { return !EnableFlag || !Tasks.empty(); });
+      if (!EnableFlag && Tasks.empty())
+        return JobSlot();
+    }
+    JobSlot Slot = Jobserver.tryAcquire();
+    if (Slot.isValid())
+      return Slot;
+    std::this_thread::sleep_for(Backoff);
+    Backoff = std::min(Backoff * 2, MaxBackoff);
+  }
+}
+
 // WaitingForGroup == nullptr means all tasks regardless of their group.
 void StdThreadPool::processTasks(ThreadPoolTaskGroup *WaitingForGroup) {
+  // With a jobserver, a worker thread only runs tasks while it holds a job
+  // slot. A nested call, from a task waiting for a group, runs the tasks under
+  // the slot that task already holds.
+  JobserverClient *Jobserver = WaitingForGroup ? nullptr : TheJobserver;
+  JobSlot Slot;
+  auto ReleaseSlot = make_scope_exit([&] {
+    if (Slot.isValid())
+      Jobserver->release(std::move(Slot));
+  });
+
   while (true) {
+    if (Jobserver && !Slot.isValid()) {
+      Slot = acquireJobSlot(*Jobserver);
+      if (!Slot.isValid())
+        return;
+    }
     std::function<void()> Task;
     ThreadPoolTaskGroup *GroupOfTask;
     {
       std::unique_lock<std::mutex> LockGuard(QueueLock);
+      if (Jobserver && Tasks.empty()) {
+        // Another thread took the work; don't sit on the slot while idle.
+        LockGuard.unlock();
+        Jobserver->release(std::move(Slot));
+        continue;
+      }
       bool workCompletedForGroup = false; // Result of workCompletedUnlocked()
       // Wait for tasks to be pushed in the queue
       QueueCondition.wait(LockGuard, [&] {
@@ -84,10 +136,6 @@ void StdThreadPool::processTasks(ThreadPoolTaskGroup *WaitingForGroup) {
       ++ActiveThreads;
       Task = std::move(Tasks.front().first);
       GroupOfTask = Tasks.front().second;
-      // Need to count active threads in each group separately, ActiveThreads
-      // would never be 0 if waiting for another group inside a wait.
-      if (GroupOfTask != nullptr)
-        ++ActiveGroups[GroupOfTask]; // Increment or set to 1 if new item
       Tasks.pop_front();
     }
 #ifndef NDEBUG
@@ -113,10 +161,12 @@ void StdThreadPool::processTasks(ThreadPoolTaskGroup *WaitingForGroup) {
       // Adjust `ActiveThreads`, in case someone waits on StdThreadPool::wait()
       std::lock_guard<std::mutex> LockGuard(QueueLock);
       --ActiveThreads;
+      // Tasks in each group are counted separately, ActiveThreads would never
+      // be 0 if waiting for another group inside a wait.
       if (GroupOfTask != nullptr) {
-        auto A = ActiveGroups.find(GroupOfTask);
+        auto A = PendingGroups.find(GroupOfTask);
         if (--(A->second) == 0)
-          ActiveGroups.erase(A);
+          PendingGroups.erase(A);
       }
       Notify = workCompletedUnlocked(GroupOfTask);
       NotifyGroup = GroupOfTask != nullptr && Notify;
@@ -136,8 +186,7 @@ void StdThreadPool::processTasks(ThreadPoolTaskGroup *WaitingForGroup) {
 bool StdThreadPool::workCompletedUnlocked(ThreadPoolTaskGroup *Group) const {
   if (Group == nullptr)
     return !ActiveThreads && Tasks.empty();
-  return ActiveGroups.count(Group) == 0 &&
-         !llvm::is_contained(llvm::make_second_range(Tasks), Group);
+  return PendingGroups.count(Group) == 0;
 }
 
 void StdThreadPool::wait() {
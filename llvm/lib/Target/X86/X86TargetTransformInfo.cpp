@@ -56,12 +56,19 @@
 #include "llvm/CodeGen/TargetLowering.h"
 #include "llvm/IR/InstIterator.h"
 #include "llvm/IR/IntrinsicInst.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Transforms/Vectorize/LoopVectorizationLegality.h"
 #include <optional>
 
 using namespace llvm;
 
 #define DEBUG_TYPE "x86tti"
 
+static cl::opt<bool> EnableAVX512TailFolding(
+    "x86-enable-avx512-tail-folding", cl::Hidden, cl::init(false),
+    cl::desc("Prefer a masked final vector iteration over a scalar epilogue "
+             "when AVX-512 masking is available"));
+
 //===----------------------------------------------------------------------===//
 //
 // X86 cost model.
@@ -6321,6 +6328,22 @@ bool X86TTIImpl::isLegalMaskedStore(Type *DataTy, Align Alignment,
   return isLegalMaskedLoadStore(ScalarTy, ST);
 }
 
+bool X86TTIImpl::preferPredicateOverEpilogue(TailFoldingInfo *TFI) const {
+  // Masked loads and stores of any element width need AVX512BW; without VLX the
+  // narrower vectors would be widened to zmm.
+  if (!EnableAVX512TailFolding || !ST->hasBWI() || !ST->hasVLX())
+    return false;
+
+  // Masked interleaved groups are costed as scalarized on X86, which is worse
+  // than keeping the unmasked groups and a scalar remainder.
+  if (TFI->IAI->hasGroups())
+    return false;
+
+  // If LV cannot fold the tail after all it falls back to a scalar epilogue,
+  // so there is no need to duplicate its legality checks here.
+  return true;
+}
+
 bool X86TTIImpl::isLegalNTLoad(Type *DataType, Align Alignment) const {
   unsigned DataSize = DL.getTypeStoreSize(DataType);
   // The only supported nontemporal loads are for aligned vectors of 16 or 32
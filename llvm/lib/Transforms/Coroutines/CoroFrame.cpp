@@ -342,7 +342,7 @@ void FrameTypeBuilder::addFieldForAllocas(const Function &F,
 
   // We need to add field for allocas at the end of this function.
   auto AddFieldForAllocasAtExit = make_scope_exit([&]() {
-    for (auto AllocaList : NonOverlapedAllocas) {
+    for (const auto &AllocaList : NonOverlapedAllocas) {
       auto *LargestAI = *AllocaList.begin();
       FieldIDType Id = addFieldForAlloca(LargestAI);
       for (auto *Alloca : AllocaList)
@@ -416,22 +416,22 @@ void FrameTypeBuilder::addFieldForAllocas(const Function &F,
     // NonOverlappedAllocaSet.
     for (auto &AllocaSet : NonOverlapedAllocas) {
       assert(!AllocaSet.empty() && "Processing Alloca Set is not empty.\n");
-      bool NoInterference = none_of(AllocaSet, [&](auto Iter) {
-        return DoAllocasInterfere(Alloca, Iter);
-      });
       // If the alignment of A is multiple of the alignment of B, the address
       // of A should satisfy the requirement for aligning for B.
       //
       // There may be other more fine-grained strategies to handle the alignment
       // infomation during the merging process. But it seems hard to handle
       // these strategies and benefit little.
-      bool Alignable = [&]() -> bool {
-        auto *LargestAlloca = *AllocaSet.begin();
-        return LargestAlloca->getAlign().value() % Alloca->getAlign().value() ==
-               0;
-      }();
-      bool CouldMerge = NoInterference && Alignable;
-      if (!CouldMerge)
+      //
+      // This is checked first since it is much cheaper than comparing the
+      // live ranges against every alloca in the set.
+      auto *LargestAlloca = *AllocaSet.begin();
+      if (LargestAlloca->getAlign().value() % Alloca->getAlign().value() != 0)
+        continue;
+      bool NoInterference = none_of(AllocaSet, [&](auto Iter) {
+        return DoAllocasInterfere(Alloca, Iter);
+      });
+      if (!NoInterference)
         continue;
       AllocaSet.push_back(Alloca);
       Merged = true;
@@ -57,6 +57,7 @@
 #endif
 
 #include <cassert>
+#include <chrono>
 #include <optional>
 #include <string>
 
@@ -94,6 +95,12 @@ static cl::opt<unsigned>
                           cl::desc("Maximal number of fixpoint iterations."),
                           cl::init(32));
 
+static cl::opt<unsigned> SetFixpointTimeBudget(
+    "attributor-fixpoint-time-budget", cl::Hidden,
+    cl::desc("Maximal wall-clock time in milliseconds spent in the fixpoint "
+             "iteration (0 = unlimited)."),
+    cl::init(0));
+
 static cl::opt<unsigned>
     MaxSpecializationPerCB("attributor-max-specializations-per-call-base",
                            cl::Hidden,
@@ -2118,6 +2125,11 @@ void Attributor::runTillFixpoint() {
   unsigned IterationCounter = 1;
   unsigned MaxIterations =
       Configuration.MaxFixpointIterations.value_or(SetFixpointIterations);
+  unsigned TimeBudgetMS =
+      Configuration.FixpointTimeBudgetMS.value_or(SetFixpointTimeBudget);
+  auto Deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(TimeBudgetMS);
+  bool OutOfTime = false;
 
   SmallVector<AbstractAttribute *, 32> ChangedAAs;
   SetVector<AbstractAttribute *> Worklist, InvalidAAs;
@@ -2202,6 +2214,11 @@ void Attributor::runTillFixpoint() {
     Worklist.insert_range(QueryAAsAwaitingUpdate);
     QueryAAsAwaitingUpdate.clear();
 
+    if (TimeBudgetMS && !Worklist.empty() &&
+        std::chrono::steady_clock::now() >= Deadline) {
+      OutOfTime = true;
+      break;
+    }
   } while (!Worklist.empty() && (IterationCounter++ < MaxIterations));
 
   if (IterationCounter > MaxIterations && !Functions.empty()) {
@@ -2212,6 +2229,15 @@ void Attributor::runTillFixpoint() {
     Function *F = Functions.front();
     emitRemark<OptimizationRemarkMissed>(F, "FixedPoint", Remark);
   }
+  if (OutOfTime && !Functions.empty()) {
+    auto Remark = [&](OptimizationRemarkMissed ORM) {
+      return ORM << "Attributor did not reach a fixpoint within "
+                 << ore::NV("TimeBudgetMS", TimeBudgetMS) << " ms after "
+                 << ore::NV("Iterations", IterationCounter) << " iterations.";
+    };
+    Function *F = Functions.front();
+    emitRemark<OptimizationRemarkMissed>(F, "FixedPointTimeBudget", Remark);
+  }
 
   LLVM_DEBUG(dbgs() << "\n[Attributor] Fixpoint iteration done after: "
                     << IterationCounter << "/" << MaxIterations
@@ -1213,29 +1213,15 @@ static bool checkVariableImport(
 }
 #endif
 
-/// Compute all the import and export for every module using the Index.
-void llvm::ComputeCrossModuleImport(
+// When computing imports we only added the variables and functions being
+// imported to the export list. We also need to mark any references and calls
+// they make as exported as well. We do this here, as it is more efficient
+// since we may import the same values multiple times into different modules
+// during the import computation.
+static void addExportedReferences(
     const ModuleSummaryIndex &Index,
     const DenseMap<StringRef, GVSummaryMapTy> &ModuleToDefinedGVSummaries,
-    function_ref<bool(GlobalValue::GUID, const GlobalValueSummary *)>
-        isPrevailing,
-    FunctionImporter::ImportListsTy &ImportLists,
     DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists) {
-  auto MIS = ModuleImportsManager::create(isPrevailing, Index, &ExportLists);
-  // For each module that has function defined, compute the import/export lists.
-  for (const auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
-    auto &ImportList = ImportLists[DefinedGVSummaries.first];
-    LLVM_DEBUG(dbgs() << "Computing import for Module '"
-                      << DefinedGVSummaries.first << "'\n");
-    MIS->computeImportForModule(DefinedGVSummaries.second,
-                                DefinedGVSummaries.first, ImportList);
-  }
-
-  // When computing imports we only added the variables and functions being
-  // imported to the export list. We also need to mark any references and calls
-  // they make as exported as well. We do this here, as it is more efficient
-  // since we may import the same values multiple times into different modules
-  // during the import computation.
   for (auto &ELI : ExportLists) {
     // `NewExports` tracks the VI that gets exported because the full definition
     // of its user/referencer gets exported.
@@ -1280,6 +1266,27 @@ void llvm::ComputeCrossModuleImport(
     }
     ELI.second.insert_range(NewExports);
   }
+}
+
+/// Compute all the import and export for every module using the Index.
+void llvm::ComputeCrossModuleImport(
+    const ModuleSummaryIndex &Index,
+    const DenseMap<StringRef, GVSummaryMapTy> &ModuleToDefinedGVSummaries,
+    function_ref<bool(GlobalValue::GUID, const GlobalValueSummary *)>
+        isPrevailing,
+    FunctionImporter::ImportListsTy &ImportLists,
+    DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists) {
+  auto MIS = ModuleImportsManager::create(isPrevailing, Index, &ExportLists);
+  // For each module that has function defined, compute the import/export lists.
+  for (const auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
+    auto &ImportList = ImportLists[DefinedGVSummaries.first];
+    LLVM_DEBUG(dbgs() << "Computing import for Module '"
+                      << DefinedGVSummaries.first << "'\n");
+    MIS->computeImportForModule(DefinedGVSummaries.second,
+                                DefinedGVSummaries.first, ImportList);
+  }
+
+  addExportedReferences(Index, ModuleToDefinedGVSummaries, ExportLists);
 
   assert(checkVariableImport(Index, ImportLists, ExportLists));
 #ifndef NDEBUG
@@ -1308,6 +1315,38 @@ void llvm::ComputeCrossModuleImport(
 #endif
 }
 
+void llvm::ComputeCrossModuleExports(
+    const ModuleSummaryIndex &Index,
+    const DenseMap<StringRef, GVSummaryMapTy> &ModuleToDefinedGVSummaries,
+    const FunctionImporter::ImportListsTy &ImportLists,
+    DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists) {
+  // The import computation exports exactly the values imported as definitions
+  // from their source modules.
+  for (const auto &ImportPerModule : ImportLists)
+    for (const auto &[FromModule, GUID, ImportType] : ImportPerModule.second)
+      if (ImportType == GlobalValueSummary::Definition)
+        ExportLists[FromModule].insert(Index.getValueInfo(GUID));
+
+  addExportedReferences(Index, ModuleToDefinedGVSummaries, ExportLists);
+}
+
+std::string llvm::getCrossModuleImportOptionsKey() {
+  // The contents of these files are not part of the key.
+  if (!WorkloadDefinitions.empty() || !UseCtxProfile.empty())
+    return "";
+
+  std::string Key;
+  raw_string_ostream OS(Key);
+  OS << ImportInstrLimit.getValue() << ',' << ImportCutoff.getValue() << ','
+     << ImportInstrFactor.getValue() << ',' << ImportHotInstrFactor.getValue()
+     << ',' << ImportHotMultiplier.getValue() << ','
+     << ImportCriticalMultiplier.getValue() << ','
+     << ImportColdMultiplier.getValue() << ',' << ComputeDead.getValue() << ','
+     << ImportDeclaration.getValue() << ',' << ForceImportAll.getValue() << ','
+     << CtxprofMoveRootsToOwnModule.getValue();
+  return Key;
+}
+
 #ifndef NDEBUG
 static void dumpImportListForModule(const ModuleSummaryIndex &Index,
                                     StringRef ModulePath,
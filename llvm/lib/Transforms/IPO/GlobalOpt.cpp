@@ -2544,6 +2544,29 @@ static bool OptimizeNonTrivialIFuncs(
 
     TargetTransformInfo &TTI = GetTTI(*Resolver);
 
+    // Find the callsites and cache the feature mask for each caller.
+    SmallVector<Function *> Callers;
+    DenseMap<Function *, SmallVector<CallBase *>> CallSites;
+    for (User *U : IF.users()) {
+      if (auto *CB = dyn_cast<CallBase>(U)) {
+        if (CB->getCalledOperand() == &IF) {
+          Function *Caller = CB->getFunction();
+          auto [FeatIt, FeatInserted] = FeatureMask.try_emplace(Caller);
+          if (FeatInserted)
+            FeatIt->second = TTI.getFeatureMask(*Caller);
+          auto [CallIt, CallInserted] = CallSites.try_emplace(Caller);
+          if (CallInserted)
+            Callers.push_back(Caller);
+          CallIt->second.push_back(CB);
+        }
+      }
+    }
+
+    // There is nothing to redirect, so don't bother walking the resolver or
+    // computing the feature masks of the versions.
+    if (Callers.empty())
+      continue;
+
     // Discover the callee versions.
     SmallVector<Function *> Callees;
     if (any_of(*Resolver, [&TTI, &Callees](BasicBlock &BB) {
@@ -2571,24 +2594,6 @@ static bool OptimizeNonTrivialIFuncs(
       return FeatureMask[LHS] > FeatureMask[RHS];
     });
 
-    // Find the callsites and cache the feature mask for each caller.
-    SmallVector<Function *> Callers;
-    DenseMap<Function *, SmallVector<CallBase *>> CallSites;
-    for (User *U : IF.users()) {
-      if (auto *CB = dyn_cast<CallBase>(U)) {
-        if (CB->getCalledOperand() == &IF) {
-          Function *Caller = CB->getFunction();
-          auto [FeatIt, FeatInserted] = FeatureMask.try_emplace(Caller);
-          if (FeatInserted)
-            FeatIt->second = TTI.getFeatureMask(*Caller);
-          auto [CallIt, CallInserted] = CallSites.try_emplace(Caller);
-          if (CallInserted)
-            Callers.push_back(Caller);
-          CallIt->second.push_back(CB);
-        }
-      }
-    }
-
     // Sort the caller versions in decreasing priority order.
     sort(Callers, [&](auto *LHS, auto *RHS) {
       return FeatureMask[LHS] > FeatureMask[RHS];
@@ -13,6 +13,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Transforms/IPO/Inliner.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/PriorityWorklist.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/ScopeExit.h"
@@ -67,6 +68,9 @@ using namespace llvm;
 
 STATISTIC(NumInlined, "Number of functions inlined");
 STATISTIC(NumDeleted, "Number of functions deleted because all callers found");
+STATISTIC(NumCallerBudgetSkipped,
+          "Number of call sites skipped because the caller exhausted its "
+          "growth budget");
 
 static cl::opt<int> IntraSCCCostMultiplier(
     "intra-scc-cost-multiplier", cl::init(2), cl::Hidden,
@@ -80,6 +84,12 @@ static cl::opt<int> IntraSCCCostMultiplier(
         "multiplied by intra-scc-cost-multiplier). This is to prevent tons of "
         "inlining through a child SCC which can cause terrible compile times"));
 
+static cl::opt<unsigned> CallerGrowthLimit(
+    "inline-caller-growth-limit", cl::init(0), cl::Hidden,
+    cl::desc("Stop inlining non-always-inline call sites into a caller once it "
+             "has grown by this many instructions within one run of the CGSCC "
+             "inliner (0 = unlimited)"));
+
 /// A flag for test, so we can print the content of the advisor when running it
 /// as part of the default (e.g. -O3) pipeline.
 static cl::opt<bool> KeepAdvisorForPrinting("keep-inline-advisor-for-printing",
@@ -303,6 +313,17 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
   // be deleted as a batch after inlining.
   SmallVector<Function *, 4> DeadFunctionsInComdats;
 
+  // Instruction count of each caller when the inliner first visited it in this
+  // run, and an estimate of its current count that adds the size of every
+  // callee inlined into it since. Recounting the caller after each inlining
+  // would be quadratic in its size. Only tracked when a growth limit is in
+  // effect.
+  struct CallerGrowth {
+    unsigned BaseSize = 0;
+    unsigned Size = 0;
+  };
+  DenseMap<Function *, CallerGrowth> CallerGrowths;
+
   // Loop forward over all of the calls. Note that we cannot cache the size as
   // inlining can introduce new calls that need to be processed.
   for (int I = 0; I < (int)Calls.size(); ++I) {
@@ -323,6 +344,16 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
       return FAM.getResult<AssumptionAnalysis>(F);
     };
 
+    // No calls to new callers are added to the map while processing this
+    // caller, so the pointer stays valid for the loop below.
+    CallerGrowth *Growth = nullptr;
+    if (CallerGrowthLimit && !OnlyMandatory) {
+      auto [It, Inserted] = CallerGrowths.try_emplace(&F);
+      if (Inserted)
+        It->second.BaseSize = It->second.Size = F.getInstructionCount();
+      Growth = &It->second;
+    }
+
     // Now process as many calls as we have within this caller in the sequence.
     // We bail out as soon as the caller has to change so we can update the
     // call graph and prepare the context of that new caller.
@@ -358,6 +389,26 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
         continue;
       }
 
+      // Once the caller is over budget, skip the cost analysis altogether for
+      // anything that is not required to be inlined.
+      if (Growth && Growth->Size > Growth->BaseSize + CallerGrowthLimit &&
+          !CB->hasFnAttr(Attribute::AlwaysInline)) {
+        unsigned Budget = Growth->BaseSize + CallerGrowthLimit;
+        LLVM_DEBUG(dbgs() << "Skipping inlining into " << F.getName()
+                          << ": caller grew past its budget of " << Budget
+                          << " instructions\n");
+        using namespace ore;
+        FAM.getResult<OptimizationRemarkEmitterAnalysis>(F).emit([&]() {
+          return OptimizationRemarkMissed(Advisor.getAnnotatedInlinePassName(),
+                                          "CallerGrowthBudget", CB)
+                 << "'" << NV("Callee", &Callee) << "' is not inlined into '"
+                 << NV("Caller", &F) << "': caller grew past its budget of "
+                 << NV("Budget", Budget) << " instructions";
+        });
+        ++NumCallerBudgetSkipped;
+        continue;
+      }
+
       std::unique_ptr<InlineAdvice> Advice =
           Advisor.getAdvice(*CB, OnlyMandatory);
 
@@ -382,6 +433,7 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
           &FAM.getResult<BlockFrequencyAnalysis>(*(CB->getCaller())),
           &FAM.getResult<BlockFrequencyAnalysis>(Callee));
 
+      unsigned CalleeSize = Growth ? Callee.getInstructionCount() : 0;
       InlineResult IR = InlineFunction(
           *CB, IFI, /*MergeAttributes=*/true,
           &FAM.getResult<AAManager>(*CB->getCaller()), true, nullptr,
@@ -397,6 +449,8 @@ PreservedAnalyses InlinerPass::run(LazyCallGraph::SCC &InitialC,
       DidInline = true;
       InlinedCallees.insert(&Callee);
       ++NumInlined;
+      if (Growth)
+        Growth->Size += CalleeSize;
 
       LLVM_DEBUG(dbgs() << "    Size after inlining: "
                         << F.getInstructionCount() << "\n");
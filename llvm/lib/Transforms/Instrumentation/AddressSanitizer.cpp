@@ -458,6 +458,9 @@ STATISTIC(NumOptimizedAccessesToGlobalVar,
           "Number of optimized accesses to global vars");
 STATISTIC(NumOptimizedAccessesToStackVar,
           "Number of optimized accesses to stack vars");
+STATISTIC(NumOptimizedRedundantAccesses,
+          "Number of optimized accesses to an address already checked in the "
+          "same basic block");
 
 namespace {
 
@@ -3065,11 +3068,17 @@ bool AddressSanitizer::instrumentFunction(Function &F,
             // instrumented the full object. But don't add to TempsToInstrument
             // because we might get another load/store with a different mask.
             if (Operand.MaybeMask) {
-              if (TempsToInstrument.count(Ptr))
-                continue; // We've seen this (whole) temp in the current BB.
+              if (TempsToInstrument.count(Ptr)) {
+                // We've seen this (whole) temp in the current BB.
+                ++NumOptimizedRedundantAccesses;
+                continue;
+              }
             } else {
-              if (!TempsToInstrument.insert(Ptr).second)
-                continue; // We've seen this temp in the current BB.
+              if (!TempsToInstrument.insert(Ptr).second) {
+                // We've seen this temp in the current BB.
+                ++NumOptimizedRedundantAccesses;
+                continue;
+              }
             }
           }
           OperandsToInstrument.push_back(Operand);
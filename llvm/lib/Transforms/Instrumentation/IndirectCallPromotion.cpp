@@ -555,10 +555,6 @@ Instruction *IndirectCallPromoter::computeVTableInfos(
   const auto &VirtualCallInfo = Iter->second;
   Instruction *VPtr = VirtualCallInfo.VPtr;
 
-  SmallDenseMap<Function *, int, 4> CalleeIndexMap;
-  for (size_t I = 0; I < Candidates.size(); I++)
-    CalleeIndexMap[Candidates[I].TargetFunction] = I;
-
   uint64_t TotalVTableCount = 0;
   auto VTableValueDataArray =
       getValueProfDataFromInst(*VirtualCallInfo.VPtr, IPVK_VTableTarget,
@@ -566,6 +562,10 @@ Instruction *IndirectCallPromoter::computeVTableInfos(
   if (VTableValueDataArray.empty())
     return VPtr;
 
+  SmallDenseMap<Function *, int, 4> CalleeIndexMap;
+  for (size_t I = 0; I < Candidates.size(); I++)
+    CalleeIndexMap[Candidates[I].TargetFunction] = I;
+
   // Compute the functions and counts from by each vtable.
   for (const auto &V : VTableValueDataArray) {
     uint64_t VTableVal = V.Value;
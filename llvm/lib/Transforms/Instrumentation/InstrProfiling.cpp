@@ -1197,6 +1197,15 @@ void InstrLowerer::lowerTimestamp(
   TimestampInstruction->eraseFromParent();
 }
 
+// Every increment targets the single counter slot that the profile data record
+// for the function points at, and the raw profile format, the runtime merge
+// and the dump code all assume exactly one such slot per counter. Sharding the
+// counters per thread or per CPU would therefore mean changing the raw format
+// rather than this lowering. For hot loops the cheaper middle ground between
+// racy and fully atomic updates is counter promotion with
+// -atomic-counter-update-promoted: the loop accumulates in a register and
+// issues a single atomic add on each exit, so the shared cache line is only
+// touched once per loop execution instead of once per iteration.
 void InstrLowerer::lowerIncrement(InstrProfIncrementInst *Inc) {
   auto *Addr = getCounterAddress(Inc);
 
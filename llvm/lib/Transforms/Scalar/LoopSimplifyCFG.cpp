@@ -490,12 +490,14 @@ private:
       unsigned TheOnlySuccDuplicates = 0;
       for (auto *Succ : successors(BB))
         if (Succ != TheOnlySucc) {
-          DeadSuccessors.insert(Succ);
+          bool FirstEdge = DeadSuccessors.insert(Succ).second;
           // If our successor lies in a different loop, we don't want to remove
           // the one-input Phi because it is a LCSSA Phi.
           bool PreserveLCSSAPhi = !L.contains(Succ);
           Succ->removePredecessor(BB, PreserveLCSSAPhi);
-          if (MSSAU)
+          // MemorySSA drops every incoming entry for BB at once, so only the
+          // first edge to each dead successor needs an update.
+          if (MSSAU && FirstEdge)
             MSSAU->removeEdge(BB, Succ);
         } else
           ++TheOnlySuccDuplicates;
@@ -1723,13 +1723,18 @@ Value *LibCallSimplifier::optimizeNew(CallInst *CI, IRBuilderBase &B,
   if (!OptimizeHotColdNew)
     return nullptr;
 
+  // The 8 bit hint is the only allocator ABI tcmalloc exposes here, so every
+  // MemProf allocation type has to be folded into a single hotness value.
+  // Richer hints (lifetime, size class, thread affinity) would need new
+  // allocator entry points to lower to.
   uint8_t HotCold;
-  if (CI->getAttributes().getFnAttr("memprof").getValueAsString() == "cold")
+  StringRef MemProfAttr =
+      CI->getAttributes().getFnAttr("memprof").getValueAsString();
+  if (MemProfAttr == "cold")
     HotCold = ColdNewHintValue;
-  else if (CI->getAttributes().getFnAttr("memprof").getValueAsString() ==
-           "notcold")
+  else if (MemProfAttr == "notcold")
     HotCold = NotColdNewHintValue;
-  else if (CI->getAttributes().getFnAttr("memprof").getValueAsString() == "hot")
+  else if (MemProfAttr == "hot")
     HotCold = HotNewHintValue;
   else
     return nullptr;
@@ -175,6 +175,9 @@ const char LLVMLoopVectorizeFollowupEpilogue[] =
 STATISTIC(LoopsVectorized, "Number of loops vectorized");
 STATISTIC(LoopsAnalyzed, "Number of loops analyzed for vectorization");
 STATISTIC(LoopsEpilogueVectorized, "Number of epilogues vectorized");
+STATISTIC(NumVFsCosted, "Number of candidate VFs costed by the VPlan planner");
+STATISTIC(NumVFsPruned,
+          "Number of candidate VFs discarded before computing their cost");
 
 static cl::opt<bool> EnableEpilogueVectorization(
     "enable-epilogue-vectorization", cl::init(true), cl::Hidden,
@@ -7124,6 +7127,7 @@ VectorizationFactor LoopVectorizationPlanner::computeBestVF() {
     BestFactor.Cost = InstructionCost::getMax();
   }
 
+  unsigned NumCosted = 0, NumPruned = 0;
   for (auto &P : VPlans) {
     ArrayRef<ElementCount> VFs(P->vectorFactors().begin(),
                                P->vectorFactors().end());
@@ -7142,6 +7146,7 @@ VectorizationFactor LoopVectorizationPlanner::computeBestVF() {
             dbgs()
             << "LV: Not considering vector loop of width " << VF
             << " because it will not generate any vector instructions.\n");
+        ++NumPruned;
         continue;
       }
       if (CM.OptForSize && !ForceVectorization && hasReplicatorRegion(*P)) {
@@ -7150,18 +7155,23 @@ VectorizationFactor LoopVectorizationPlanner::computeBestVF() {
             << "LV: Not considering vector loop of width " << VF
             << " because it would cause replicated blocks to be generated,"
             << " which isn't allowed when optimizing for size.\n");
+        ++NumPruned;
         continue;
       }
 
-      InstructionCost Cost = cost(*P, VF);
-      VectorizationFactor CurrentFactor(VF, Cost, ScalarCost);
-
+      // Register pressure does not depend on the cost, so reject the VF before
+      // paying for a full recipe costing of the plan.
       if (CM.useMaxBandwidth(VF) && RUs[I].exceedsMaxNumRegs(TTI)) {
         LLVM_DEBUG(dbgs() << "LV(REG): Not considering vector loop of width "
                           << VF << " because it uses too many registers\n");
+        ++NumPruned;
         continue;
       }
 
+      InstructionCost Cost = cost(*P, VF);
+      VectorizationFactor CurrentFactor(VF, Cost, ScalarCost);
+      ++NumCosted;
+
       if (isMoreProfitable(CurrentFactor, BestFactor, P->hasScalarTail()))
         BestFactor = CurrentFactor;
 
@@ -7170,6 +7180,11 @@ VectorizationFactor LoopVectorizationPlanner::computeBestVF() {
         ProfitableVFs.push_back(CurrentFactor);
     }
   }
+  NumVFsCosted += NumCosted;
+  NumVFsPruned += NumPruned;
+  LLVM_DEBUG(dbgs() << "LV: Costed " << NumCosted << " candidate VF(s) across "
+                    << VPlans.size() << " plan(s), pruned " << NumPruned
+                    << " before costing.\n");
 
 #ifndef NDEBUG
   // Select the optimal vectorization factor according to the legacy cost-model.
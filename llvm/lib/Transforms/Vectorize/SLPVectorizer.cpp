@@ -22187,6 +22187,10 @@ public:
               .insert(std::make_pair(V, 0))
               .first->second;
       }
+      // Reduction operations are not required to be in the root's block: as
+      // operands they dominate the root, so the tree may extend into
+      // predecessors. Each step away from BB costs one level of
+      // RecursionMaxDepth to bound the search.
       for (Instruction *I : reverse(PossibleReductionOps))
         Worklist.emplace_back(I, I->getParent() == BB ? 0 : Level + 1);
     }
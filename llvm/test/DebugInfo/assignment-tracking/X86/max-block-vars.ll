@@ -0,0 +1,41 @@
+; RUN: llc -mtriple=x86_64 %s -o /dev/null -debug-ata-max-block-vars=1 \
+; RUN:   -pass-remarks-missed=debug-ata 2>&1 | FileCheck %s --check-prefix=DROP
+; RUN: llc -mtriple=x86_64 %s -o /dev/null -pass-remarks-missed=debug-ata 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=KEEP --allow-empty
+
+;; With one block and one tracked variable, a limit of 1 is exceeded and the
+;; variable locations of @fun are dropped. The default limit is not.
+
+; DROP: remark: test.c:1:0: variable locations dropped: 1 blocks times 1 variables exceeds -debug-ata-max-block-vars=1
+; KEEP-NOT: remark
+
+define dso_local void @fun(i32 %v) !dbg !7 {
+entry:
+  %x = alloca i32, align 4, !DIAssignID !13
+    #dbg_assign(i1 poison, !11, !DIExpression(), !13, ptr %x, !DIExpression(), !14)
+  store i32 %v, ptr %x, align 4, !DIAssignID !15
+    #dbg_assign(i32 %v, !11, !DIExpression(), !15, ptr %x, !DIExpression(), !14)
+  call void @esc(ptr %x), !dbg !16
+  ret void, !dbg !16
+}
+
+declare void @esc(ptr)
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3, !4}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C99, file: !1, producer: "clang", isOptimized: true, runtimeVersion: 0, emissionKind: FullDebug)
+!1 = !DIFile(filename: "test.c", directory: "/")
+!2 = !{i32 7, !"Dwarf Version", i32 5}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = !{i32 7, !"debug-info-assignment-tracking", i1 true}
+!7 = distinct !DISubprogram(name: "fun", scope: !1, file: !1, line: 1, type: !8, scopeLine: 1, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !0, retainedNodes: !10)
+!8 = !DISubroutineType(types: !9)
+!9 = !{null, !12}
+!10 = !{!11}
+!11 = !DILocalVariable(name: "x", scope: !7, file: !1, line: 2, type: !12)
+!12 = !DIBasicType(name: "int", size: 32, encoding: DW_ATE_signed)
+!13 = distinct !DIAssignID()
+!14 = !DILocation(line: 0, scope: !7)
+!15 = distinct !DIAssignID()
+!16 = !DILocation(line: 3, column: 1, scope: !7)
@@ -0,0 +1,38 @@
+; RUN: opt -passes=inline -inline-caller-growth-limit=3 -S < %s | FileCheck %s
+; RUN: opt -passes=inline -inline-caller-growth-limit=3 -disable-output \
+; RUN:   -pass-remarks-missed=inline < %s 2>&1 | FileCheck %s --check-prefix=REMARK
+; RUN: opt -passes=inline -S < %s | FileCheck %s --check-prefix=NOLIMIT
+
+;; @caller starts with 5 instructions, so its budget is 8. Inlining the first
+;; call to @big takes it past the budget, and the other calls are kept, except
+;; for the always-inline one.
+
+; CHECK-LABEL: define i32 @caller(
+; CHECK-NOT:     call i32 @big(
+; CHECK:         call i32 @big(
+; CHECK-NEXT:    call i32 @big(
+; CHECK-NOT:     call
+; CHECK:         ret i32
+
+; REMARK-COUNT-2: remark: {{.*}} 'big' is not inlined into 'caller': caller grew past its budget of 8 instructions
+; REMARK-NOT:     remark
+
+; NOLIMIT-LABEL: define i32 @caller(
+; NOLIMIT-NOT:     call
+; NOLIMIT:         ret i32
+
+define i32 @big(i32 %x) {
+  %a = add i32 %x, 1
+  %b = mul i32 %a, 3
+  %c = xor i32 %b, 5
+  %d = sub i32 %c, 7
+  ret i32 %d
+}
+
+define i32 @caller(i32 %x) {
+  %r1 = call i32 @big(i32 %x)
+  %r2 = call i32 @big(i32 %r1)
+  %r3 = call i32 @big(i32 %r2)
+  %r4 = call i32 @big(i32 %r3) alwaysinline
+  ret i32 %r4
+}
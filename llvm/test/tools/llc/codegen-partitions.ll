@@ -0,0 +1,47 @@
+; REQUIRES: x86-registered-target
+;; -codegen-partitions=N writes partition 0 to the output file and partition
+;; I to <output>.I, with remarks split the same way.
+
+; RUN: rm -rf %t && mkdir %t && cd %t
+; RUN: llc -mtriple=x86_64 -codegen-partitions=2 %s -o out.s \
+; RUN:   -pass-remarks-output=remarks.yaml
+; RUN: ls out.s out.s.1 remarks.yaml remarks.yaml.1
+; RUN: cat out.s out.s.1 | FileCheck %s
+; RUN: cat remarks.yaml remarks.yaml.1 | FileCheck %s --check-prefix=REMARKS
+
+;; Every function is compiled in exactly one partition.
+; CHECK-DAG: {{^}}f1:
+; CHECK-DAG: {{^}}f2:
+; CHECK-DAG: {{^}}f3:
+
+; REMARKS-DAG: Function: f1
+; REMARKS-DAG: Function: f2
+; REMARKS-DAG: Function: f3
+
+;; The same holds for object files.
+; RUN: llc -mtriple=x86_64 -codegen-partitions=2 -filetype=obj %s -o out.o
+; RUN: llvm-nm out.o out.o.1 | FileCheck %s --check-prefix=NM
+; NM-DAG: T f1
+; NM-DAG: T f2
+; NM-DAG: T f3
+
+; RUN: not llc -mtriple=x86_64 -codegen-partitions=2 %s -o - 2>&1 | \
+; RUN:   FileCheck %s --check-prefix=ERR
+; RUN: not llc -mtriple=x86_64 -codegen-partitions=2 -enable-new-pm %s \
+; RUN:   -o out2.s 2>&1 | FileCheck %s --check-prefix=ERR
+; ERR: -codegen-partitions requires IR input, a named output file and no -run-pass, -passes, -enable-new-pm, -compile-twice or -split-dwarf-output
+
+define i32 @f1(i32 %a) {
+  %r = add i32 %a, 1
+  ret i32 %r
+}
+
+define i32 @f2(i32 %a) {
+  %r = mul i32 %a, 3
+  ret i32 %r
+}
+
+define i32 @f3(i32 %a) {
+  %r = call i32 @f1(i32 %a)
+  ret i32 %r
+}
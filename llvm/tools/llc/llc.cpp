@@ -15,7 +15,10 @@
 #include "NewPMDriver.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/ScopeExit.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/CodeGen/CommandFlags.h"
 #include "llvm/CodeGen/LinkAllAsmWriterComponents.h"
 #include "llvm/CodeGen/LinkAllCodegenComponents.h"
@@ -47,6 +50,7 @@
 #include "llvm/Support/PluginLoader.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/WithColor.h"
@@ -56,6 +60,8 @@
 #include "llvm/TargetParser/SubtargetFeature.h"
 #include "llvm/TargetParser/Triple.h"
 #include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Transforms/Utils/SplitModule.h"
+#include <atomic>
 #include <memory>
 #include <optional>
 using namespace llvm;
@@ -140,6 +146,14 @@ static cl::opt<bool>
     DisableSimplifyLibCalls("disable-simplify-libcalls",
                             cl::desc("Disable simplify-libcalls"));
 
+static cl::opt<unsigned> CodeGenPartitions(
+    "codegen-partitions", cl::init(1),
+    cl::desc("Split the module into this many partitions and compile them in "
+             "parallel. Partition 0 is written to the output file and "
+             "partition N to '<output>.N', and likewise for "
+             "-pass-remarks-output"),
+    cl::value_desc("N"));
+
 static cl::opt<bool> ShowMCEncoding("show-mc-encoding", cl::Hidden,
                                     cl::desc("Show encoding in .s output"));
 
@@ -383,10 +397,13 @@ int main(int argc, char **argv) {
   // Set a diagnostic handler that doesn't exit on the first error
   Context.setDiagnosticHandler(std::make_unique<LLCDiagnosticHandler>());
 
+  // With -codegen-partitions, each partition sets up remarks in its own
+  // context (see compileSplitModule).
   Expected<std::unique_ptr<ToolOutputFile>> RemarksFileOrErr =
-      setupLLVMOptimizationRemarks(Context, RemarksFilename, RemarksPasses,
-                                   RemarksFormat, RemarksWithHotness,
-                                   RemarksHotnessThreshold);
+      setupLLVMOptimizationRemarks(
+          Context, CodeGenPartitions > 1 ? StringRef() : RemarksFilename,
+          RemarksPasses, RemarksFormat, RemarksWithHotness,
+          RemarksHotnessThreshold);
   if (Error E = RemarksFileOrErr.takeError())
     reportError(std::move(E), RemarksFilename);
   std::unique_ptr<ToolOutputFile> RemarksFile = std::move(*RemarksFileOrErr);
@@ -434,6 +451,119 @@ static bool addPass(PassManagerBase &PM, const char *argv0,
   return false;
 }
 
+/// Compile \p M as CodeGenPartitions separate modules, each in its own context
+/// and on its own thread. Functions in a single module can't be code generated
+/// concurrently since they share one MCContext, so this uses the same
+/// SplitModule-based approach as parallel LTO code generation. The partitions
+/// are written in a deterministic order to \p Out and "<output>.N", and their
+/// remarks to "<remarks>" and "<remarks>.N". Existing files with these names
+/// are overwritten, and the side files are only kept if every partition
+/// compiles successfully.
+static int compileSplitModule(const char *ProgName, Module &M,
+                              TargetMachine &TM,
+                              const TargetLibraryInfoImpl &TLII,
+                              ToolOutputFile &Out) {
+  const Target &T = TM.getTarget();
+  DefaultThreadPool Pool(heavyweight_hardware_concurrency(CodeGenPartitions));
+  std::vector<std::unique_ptr<ToolOutputFile>> PartOuts;
+  // Indexed by partition so that each worker only writes its own slot.
+  std::vector<std::unique_ptr<ToolOutputFile>> PartRemarks(CodeGenPartitions);
+  std::atomic<bool> HasErrors(false);
+  unsigned PartIdx = 0;
+
+  auto HandlePartition = [&](std::unique_ptr<Module> MPart) {
+    // Serialize on the main thread; each worker rebuilds its partition in a
+    // fresh context.
+    SmallString<0> BC;
+    raw_svector_ostream BCOS(BC);
+    WriteBitcodeToFile(*MPart, BCOS);
+
+    std::string PartSuffix = PartIdx == 0 ? "" : "." + utostr(PartIdx);
+    ToolOutputFile *PartOut = &Out;
+    if (PartIdx != 0) {
+      std::error_code EC;
+      std::string Name = OutputFilename + PartSuffix;
+      sys::fs::OpenFlags Flags =
+          codegen::getFileType() == CodeGenFileType::AssemblyFile
+              ? sys::fs::OF_TextWithCRLF
+              : sys::fs::OF_None;
+      PartOuts.push_back(std::make_unique<ToolOutputFile>(Name, EC, Flags));
+      if (EC)
+        reportError(EC.message(), Name);
+      PartOut = PartOuts.back().get();
+    }
+    unsigned Idx = PartIdx++;
+
+    Pool.async(
+        [&, PartOut, Idx, PartSuffix](const SmallString<0> &BC) {
+          // Set up the context like the one in main() for the serial path.
+          LLVMContext Ctx;
+          Ctx.setDiscardValueNames(DiscardValueNames);
+          Ctx.setDiagnosticHandler(std::make_unique<LLCDiagnosticHandler>());
+          std::string RemarksName =
+              RemarksFilename.empty() ? "" : RemarksFilename + PartSuffix;
+          Expected<std::unique_ptr<ToolOutputFile>> RemarksFileOrErr =
+              setupLLVMOptimizationRemarks(Ctx, RemarksName, RemarksPasses,
+                                           RemarksFormat, RemarksWithHotness,
+                                           RemarksHotnessThreshold);
+          if (!RemarksFileOrErr) {
+            WithColor::error(errs(), ProgName)
+                << RemarksName << ": "
+                << toString(RemarksFileOrErr.takeError()) << "\n";
+            HasErrors = true;
+            return;
+          }
+          PartRemarks[Idx] = std::move(*RemarksFileOrErr);
+
+          Expected<std::unique_ptr<Module>> MOrErr =
+              parseBitcodeFile(MemoryBufferRef(BC.str(), "llc-part"), Ctx);
+          if (!MOrErr) {
+            WithColor::error(errs(), ProgName)
+                << toString(MOrErr.takeError()) << "\n";
+            HasErrors = true;
+            return;
+          }
+          std::unique_ptr<TargetMachine> PartTM(T.createTargetMachine(
+              TM.getTargetTriple(), TM.getTargetCPU(),
+              TM.getTargetFeatureString(), TM.Options,
+              TM.getRelocationModel(), TM.getCodeModel(), TM.getOptLevel()));
+
+          legacy::PassManager PM;
+          PM.add(new TargetLibraryInfoWrapperPass(TLII));
+          auto *MMIWP = new MachineModuleInfoWrapperPass(PartTM.get());
+          if (PartTM->addPassesToEmitFile(PM, PartOut->os(), nullptr,
+                                          codegen::getFileType(), NoVerify,
+                                          MMIWP)) {
+            WithColor::error(errs(), ProgName)
+                << "target does not support generation of this file type\n";
+            HasErrors = true;
+            return;
+          }
+          const_cast<TargetLoweringObjectFile *>(PartTM->getObjFileLowering())
+              ->Initialize(MMIWP->getMMI().getContext(), *PartTM);
+          PM.run(**MOrErr);
+          if (Ctx.getDiagHandlerPtr()->HasErrors)
+            HasErrors = true;
+        },
+        std::move(BC));
+  };
+
+  // Try target-specific module splitting first, then fall back to the default.
+  if (!TM.splitModule(M, CodeGenPartitions, HandlePartition))
+    SplitModule(M, CodeGenPartitions, HandlePartition,
+                /*PreserveLocals=*/false);
+  Pool.wait();
+
+  if (HasErrors)
+    return 1;
+  for (std::unique_ptr<ToolOutputFile> &PartOut : PartOuts)
+    PartOut->keep();
+  for (std::unique_ptr<ToolOutputFile> &RemarksFile : PartRemarks)
+    if (RemarksFile)
+      RemarksFile->keep();
+  return 0;
+}
+
 static int compileModule(char **argv, LLVMContext &Context) {
   // Load the module to be compiled...
   SMDiagnostic Err;
@@ -649,6 +779,18 @@ static int compileModule(char **argv, LLVMContext &Context) {
   else if (VerifyEach)
     VK = VerifierKind::EachPass;
 
+  if (CodeGenPartitions > 1) {
+    if (MIR || !getRunPassNames().empty() || CompileTwice || DwoOut ||
+        OutputFilename == "-" || EnableNewPassManager || !PassPipeline.empty())
+      reportError("-codegen-partitions requires IR input, a named output file "
+                  "and no -run-pass, -passes, -enable-new-pm, -compile-twice "
+                  "or -split-dwarf-output");
+    if (compileSplitModule(argv[0], *M, *Target, TLII, *Out))
+      return 1;
+    Out->keep();
+    return 0;
+  }
+
   if (EnableNewPassManager || !PassPipeline.empty()) {
     return compileModuleWithNewPM(argv[0], std::move(M), std::move(MIR),
                                   std::move(Target), std::move(Out),
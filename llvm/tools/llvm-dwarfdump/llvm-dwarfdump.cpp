@@ -294,6 +294,10 @@ static opt<unsigned> VerifyNumThreads(
          "output to be non determinisitic, but can speed up verification and "
          "is useful when running with the summary only or JSON summary modes."),
     cat(DwarfDumpCategory));
+static opt<bool> VerifyTimings(
+    "verify-timings",
+    desc("Print the time spent in each group of checks after --verify."),
+    cat(DwarfDumpCategory));
 static opt<ErrorDetailLevel> ErrorDetails(
     "error-display", init(Unspecified),
     desc("Set the level of detail and summary to display when verifying "
@@ -366,6 +370,7 @@ static DIDumpOptions getDumpOpts(DWARFContext &C) {
                        ErrorDetails != NoDetailsOrSummary;
     DumpOpts.ShowAggregateErrors = ErrorDetails != OnlyDetailsNoSummary &&
                                    ErrorDetails != NoDetailsOnlySummary;
+    DumpOpts.ShowVerifyTimings = VerifyTimings;
     DumpOpts.JsonErrSummaryFile = JsonErrSummaryFile;
     return DumpOpts.noImplicitRecursion();
   }
@@ -355,8 +355,8 @@ static std::vector<unsigned> getOpcodesOrDie(const LLVMState &State) {
 
 // Generates code snippets for opcode `Opcode`.
 static Expected<std::vector<BenchmarkCode>>
-generateSnippets(const LLVMState &State, unsigned Opcode,
-                 const BitVector &ForbiddenRegs) {
+generateSnippets(const LLVMState &State, const SnippetGenerator &Generator,
+                 unsigned Opcode, const BitVector &ForbiddenRegs) {
   // Ignore instructions that we cannot run.
   if (const char *Reason =
           State.getExegesisTarget().getIgnoredOpcodeReasonOrNull(State, Opcode))
@@ -367,20 +367,12 @@ generateSnippets(const LLVMState &State, unsigned Opcode,
       State.getExegesisTarget().generateInstructionVariants(
           Instr, MaxConfigsPerOpcode);
 
-  SnippetGenerator::Options SnippetOptions;
-  SnippetOptions.MaxConfigsPerOpcode = MaxConfigsPerOpcode;
-  const std::unique_ptr<SnippetGenerator> Generator =
-      State.getExegesisTarget().createSnippetGenerator(BenchmarkMode, State,
-                                                       SnippetOptions);
-  if (!Generator)
-    ExitWithError("cannot create snippet generator");
-
   std::vector<BenchmarkCode> Benchmarks;
   for (const InstructionTemplate &Variant : InstructionVariants) {
     if (Benchmarks.size() >= MaxConfigsPerOpcode)
       break;
-    if (auto Err = Generator->generateConfigurations(Variant, Benchmarks,
-                                                     ForbiddenRegs))
+    if (auto Err = Generator.generateConfigurations(Variant, Benchmarks,
+                                                    ForbiddenRegs))
       return std::move(Err);
   }
   return Benchmarks;
@@ -543,7 +535,21 @@ void benchmarkMain() {
   for (const std::unique_ptr<const SnippetRepetitor> &Repetitor : Repetitors)
     AllReservedRegs |= Repetitor->getReservedRegs();
 
+  if (MinInstructions == 0) {
+    ExitOnErr.setBanner("llvm-exegesis: ");
+    ExitWithError("--min-instructions must be greater than zero");
+  }
+
   if (!Opcodes.empty()) {
+    // Snippet generators are stateless, so use a single one for all opcodes.
+    SnippetGenerator::Options SnippetOptions;
+    SnippetOptions.MaxConfigsPerOpcode = MaxConfigsPerOpcode;
+    const std::unique_ptr<SnippetGenerator> Generator =
+        State.getExegesisTarget().createSnippetGenerator(BenchmarkMode, State,
+                                                         SnippetOptions);
+    if (!Generator)
+      ExitWithError("cannot create snippet generator");
+
     for (const unsigned Opcode : Opcodes) {
       // Ignore instructions without a sched class if
       // -ignore-invalid-sched-class is passed.
@@ -554,7 +560,8 @@ void benchmarkMain() {
         continue;
       }
 
-      auto ConfigsForInstr = generateSnippets(State, Opcode, AllReservedRegs);
+      auto ConfigsForInstr =
+          generateSnippets(State, *Generator, Opcode, AllReservedRegs);
       if (!ConfigsForInstr) {
         logAllUnhandledErrors(
             ConfigsForInstr.takeError(), errs(),
@@ -566,11 +573,6 @@ void benchmarkMain() {
     }
   }
 
-  if (MinInstructions == 0) {
-    ExitOnErr.setBanner("llvm-exegesis: ");
-    ExitWithError("--min-instructions must be greater than zero");
-  }
-
   // Write to standard output if file is not set.
   if (BenchmarkFile.empty())
     BenchmarkFile = "-";
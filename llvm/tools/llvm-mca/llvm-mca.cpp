@@ -617,7 +617,9 @@ int main(int argc, char **argv) {
     if (Region->empty())
       continue;
 
-    IB.clear();
+    // Descriptors only depend on the subtarget and the instruments, so they
+    // can be shared by all regions.
+    IB.resetWarnings();
 
     // Lower the MCInst sequence into an mca::Instruction sequence.
     ArrayRef<MCInst> Insts = Region->getInstructions();
@@ -1069,6 +1069,10 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
                    Contexts[End - 1].get());
         Pool.wait();
       }
+      // Every context past Mid has been drained into a lower one (and its
+      // deferred errors moved along with it), so free it now rather than
+      // holding every writer's records until the end of the merge.
+      Contexts.truncate(Mid);
       End = Mid;
       Mid /= 2;
     } while (Mid > 0);
@@ -533,6 +533,10 @@ static std::string getContextKeyStr(ContextKey *K,
 }
 
 void HybridPerfReader::unwindSamples() {
+  // Unwinding runs serially over the already de-duplicated samples. Although
+  // each sample could populate its own counter map, building context keys goes
+  // through ProfiledBinary's symbolizer and its address-to-frame caches, which
+  // are not thread-safe; those would need to be made so first.
   VirtualUnwinder Unwinder(&SampleCounters, Binary);
   for (const auto &Item : AggregatedSamples) {
     const PerfSample *Sample = Item.first.getPtr();
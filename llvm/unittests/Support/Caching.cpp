@@ -12,6 +12,9 @@
 #include "llvm/Support/Path.h"
 #include "llvm/Testing/Support/Error.h"
 #include "gtest/gtest.h"
+#include <atomic>
+#include <map>
+#include <mutex>
 
 using namespace llvm;
 
@@ -155,3 +158,100 @@ TEST(Caching, NoCommit) {
 
   ASSERT_NO_ERROR(sys::fs::remove_directories(CacheDir.str()));
 }
+
+namespace {
+// An in-memory store that counts how often it is asked for an entry.
+class FakeRemoteStore : public RemoteCacheStore {
+public:
+  Expected<std::unique_ptr<MemoryBuffer>> get(StringRef Key) override {
+    ++NumGets;
+    std::lock_guard<std::mutex> Lock(Mu);
+    auto It = Blobs.find(Key.str());
+    if (It == Blobs.end())
+      return nullptr;
+    return MemoryBuffer::getMemBufferCopy(It->second);
+  }
+
+  Error put(StringRef Key, StringRef Data) override {
+    std::lock_guard<std::mutex> Lock(Mu);
+    Blobs[Key.str()] = Data.str();
+    return Error::success();
+  }
+
+  std::mutex Mu;
+  std::map<std::string, std::string> Blobs;
+  std::atomic<unsigned> NumGets = 0;
+};
+
+struct RemoteCachingTest : testing::Test {
+  void SetUp() override {
+    sys::fs::createUniquePath("llvm_test_cache-%%%%%%", CacheDir, true);
+    sys::fs::remove_directories(CacheDir.str());
+    Store = std::make_shared<FakeRemoteStore>();
+  }
+
+  void TearDown() override {
+    ASSERT_NO_ERROR(sys::fs::remove_directories(CacheDir.str()));
+  }
+
+  FileCache createCache() {
+    auto CacheOrErr = remoteCache(
+        "LLVMTestCache", "LLVMTest", CacheDir, Store, /*MaxFetchThreads=*/2,
+        [this](unsigned Task, const Twine &ModuleName,
+               std::unique_ptr<MemoryBuffer> M) { CachedBuffer = std::move(M); });
+    EXPECT_TRUE(bool(CacheOrErr));
+    return std::move(*CacheOrErr);
+  }
+
+  SmallString<256> CacheDir;
+  std::shared_ptr<FakeRemoteStore> Store;
+  std::unique_ptr<MemoryBuffer> CachedBuffer;
+};
+} // namespace
+
+TEST_F(RemoteCachingTest, ReadThrough) {
+  Store->Blobs["foo"] = data;
+  {
+    FileCache Cache = createCache();
+    Cache.prefetch("foo");
+    auto AddStreamOrErr = Cache(1, "foo", "");
+    ASSERT_TRUE(bool(AddStreamOrErr));
+    EXPECT_FALSE(*AddStreamOrErr);
+    ASSERT_TRUE(CachedBuffer);
+    EXPECT_EQ(CachedBuffer->getBuffer(), StringRef(data));
+    // The prefetched result was used, not fetched again.
+    EXPECT_EQ(Store->NumGets.load(), 1u);
+  }
+
+  // The entry was added to the local cache, so the store is not consulted
+  // any more, not even by prefetch().
+  Store->Blobs.clear();
+  CachedBuffer.reset();
+  FileCache Cache = createCache();
+  Cache.prefetch("foo");
+  auto AddStreamOrErr = Cache(1, "foo", "");
+  ASSERT_TRUE(bool(AddStreamOrErr));
+  EXPECT_FALSE(*AddStreamOrErr);
+  ASSERT_TRUE(CachedBuffer);
+  EXPECT_EQ(CachedBuffer->getBuffer(), StringRef(data));
+  EXPECT_EQ(Store->NumGets.load(), 1u);
+}
+
+TEST_F(RemoteCachingTest, WriteBack) {
+  {
+    FileCache Cache = createCache();
+    auto AddStreamOrErr = Cache(1, "foo", "");
+    ASSERT_TRUE(bool(AddStreamOrErr));
+    AddStreamFn &AddStream = *AddStreamOrErr;
+    ASSERT_TRUE(AddStream);
+
+    auto FileOrErr = AddStream(1, "");
+    ASSERT_TRUE(bool(FileOrErr));
+    *(*FileOrErr)->OS << data;
+    ASSERT_THAT_ERROR((*FileOrErr)->commit(), Succeeded());
+    // Destroying the cache waits for the upload.
+  }
+  std::lock_guard<std::mutex> Lock(Store->Mu);
+  ASSERT_EQ(Store->Blobs.count("foo"), 1u);
+  EXPECT_EQ(Store->Blobs["foo"], data);
+}
@@ -0,0 +1,221 @@
+//===- unittests/Support/JobserverTest.cpp - Jobserver client tests -------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/Jobserver.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/ThreadPool.h"
+#include "gtest/gtest.h"
+
+#ifdef LLVM_ON_UNIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace llvm;
+
+namespace {
+
+TEST(JobserverTest, NoJobserver) {
+  EXPECT_EQ(JobserverClient::create(""), nullptr);
+  EXPECT_EQ(JobserverClient::create("-j8"), nullptr);
+  EXPECT_EQ(JobserverClient::create("ks -j8 --no-print-directory"), nullptr);
+  // make passes negative descriptors to processes it did not give access to
+  // the jobserver.
+  EXPECT_EQ(JobserverClient::create("-j8 --jobserver-auth=-2,-2"), nullptr);
+  EXPECT_EQ(JobserverClient::create("-j8 --jobserver-auth=3"), nullptr);
+}
+
+#ifdef LLVM_ON_UNIX
+
+class JobserverPipeTest : public testing::Test {
+protected:
+  void SetUp() override { ASSERT_EQ(::pipe(FDs), 0); }
+
+  void TearDown() override {
+    ::close(FDs[0]);
+    ::close(FDs[1]);
+  }
+
+  void addTokens(unsigned Count) {
+    std::string Tokens(Count, '+');
+    ASSERT_EQ(::write(FDs[1], Tokens.data(), Tokens.size()),
+              static_cast<ssize_t>(Tokens.size()));
+  }
+
+  std::string getMakeFlags(StringRef Option = "--jobserver-auth=") {
+    return "-j3 " + Option.str() + std::to_string(FDs[0]) + "," +
+           std::to_string(FDs[1]);
+  }
+
+  int FDs[2] = {-1, -1};
+};
+
+#ifdef __linux__
+
+TEST_F(JobserverPipeTest, AcquireAndRelease) {
+  addTokens(2);
+  std::unique_ptr<JobserverClient> Client =
+      JobserverClient::create(getMakeFlags());
+  ASSERT_NE(Client, nullptr);
+  EXPECT_EQ(Client->getNumJobs(), 3u);
+
+  // The implicit slot comes first, then the tokens in the pipe.
+  std::vector<JobSlot> Slots;
+  for (unsigned I = 0; I < 3; ++I) {
+    Slots.push_back(Client->tryAcquire());
+    EXPECT_TRUE(Slots.back().isValid());
+  }
+  EXPECT_TRUE(Slots[0].isImplicit());
+  EXPECT_TRUE(Slots[1].isExplicit());
+  EXPECT_EQ(Slots[1].getExplicitToken(), '+');
+  EXPECT_TRUE(Slots[2].isExplicit());
+  EXPECT_FALSE(Client->tryAcquire().isValid());
+
+  // A released slot can be acquired again.
+  Client->release(std::move(Slots[1]));
+  EXPECT_FALSE(Slots[1].isValid());
+  JobSlot Again = Client->tryAcquire();
+  EXPECT_TRUE(Again.isExplicit());
+  Client->release(std::move(Again));
+
+  Client->release(std::move(Slots[0]));
+  Again = Client->tryAcquire();
+  EXPECT_TRUE(Again.isImplicit());
+  Client->release(std::move(Again));
+
+  // Both tokens are back in the pipe.
+  Client->release(std::move(Slots[2]));
+  Client.reset();
+  ASSERT_EQ(::fcntl(FDs[0], F_SETFL, O_NONBLOCK), 0);
+  char Buf[4];
+  EXPECT_EQ(::read(FDs[0], Buf, sizeof(Buf)), 2);
+}
+
+TEST_F(JobserverPipeTest, OldOptionSpelling) {
+  EXPECT_NE(JobserverClient::create(getMakeFlags("--jobserver-fds=")),
+            nullptr);
+}
+
+TEST_F(JobserverPipeTest, EmptyPipeDoesNotBlock) {
+  std::unique_ptr<JobserverClient> Client =
+      JobserverClient::create(getMakeFlags());
+  ASSERT_NE(Client, nullptr);
+  JobSlot Implicit = Client->tryAcquire();
+  EXPECT_TRUE(Implicit.isImplicit());
+  // The pipe is empty and blocking, and this must return right away.
+  EXPECT_FALSE(Client->tryAcquire().isValid());
+  Client->release(std::move(Implicit));
+  // The client reads through its own description of the pipe, and leaves the
+  // one shared with the rest of the build blocking.
+  EXPECT_FALSE(::fcntl(FDs[0], F_GETFL) & O_NONBLOCK);
+}
+
+#if LLVM_ENABLE_THREADS
+// Runs tasks on a pool that uses the jobserver, and exits with 0 if they all
+// ran, no more than two at a time, and the token went back to the pipe.
+static void runThreadPoolAndExit(int ReadFD, const std::string &MakeFlags) {
+  ::setenv("MAKEFLAGS", MakeFlags.c_str(), 1);
+  std::atomic<int> Running(0), MaxRunning(0), Done(0);
+  {
+    // The implicit slot and the one token allow two tasks at a time.
+    StdThreadPool Pool(jobserver_concurrency(4));
+    for (int I = 0; I < 8; ++I)
+      Pool.async([&] {
+        int N = ++Running;
+        int Max = MaxRunning;
+        while (N > Max && !MaxRunning.compare_exchange_weak(Max, N))
+          ;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        --Running;
+        ++Done;
+      });
+    Pool.wait();
+  }
+  char Buf[2];
+  ::fcntl(ReadFD, F_SETFL, O_NONBLOCK);
+  bool TokenReturned = ::read(ReadFD, Buf, sizeof(Buf)) == 1;
+  std::exit(Done == 8 && MaxRunning <= 2 && TokenReturned ? 0 : 1);
+}
+
+TEST_F(JobserverPipeTest, ThreadPool) {
+  // MAKEFLAGS is read once per process, so run the pool in a fresh child.
+  testing::GTEST_FLAG(death_test_style) = "threadsafe";
+  addTokens(1);
+  EXPECT_EXIT(runThreadPoolAndExit(FDs[0], getMakeFlags()),
+              testing::ExitedWithCode(0), "");
+}
+#endif // LLVM_ENABLE_THREADS
+
+#else
+
+TEST_F(JobserverPipeTest, PipeNotSupported) {
+  // Without a way to read the inherited pipe without blocking, it is not used.
+  EXPECT_EQ(JobserverClient::create(getMakeFlags()), nullptr);
+}
+
+#endif // __linux__
+
+TEST(JobserverTest, NotAPipe) {
+  // make closes the pipe in processes it does not consider to be recursive
+  // makes, and the descriptors may then refer to something else.
+  int FD = ::open("/dev/null", O_RDWR);
+  ASSERT_GE(FD, 0);
+  std::string MakeFlags =
+      "-j3 --jobserver-auth=" + std::to_string(FD) + "," + std::to_string(FD);
+  EXPECT_EQ(JobserverClient::create(MakeFlags), nullptr);
+  ::close(FD);
+}
+
+TEST(JobserverTest, Fifo) {
+  SmallString<128> Dir;
+  ASSERT_FALSE(sys::fs::createUniqueDirectory("jobserver-test", Dir));
+  SmallString<128> Fifo(Dir);
+  sys::path::append(Fifo, "fifo");
+  ASSERT_EQ(::mkfifo(Fifo.c_str(), 0600), 0);
+
+  int WriteFD = ::open(Fifo.c_str(), O_RDWR | O_NONBLOCK);
+  ASSERT_GE(WriteFD, 0);
+  ASSERT_EQ(::write(WriteFD, "+", 1), 1);
+
+  std::unique_ptr<JobserverClient> Client =
+      JobserverClient::create(("-j2 --jobserver-auth=fifo:" + Fifo).str());
+  ASSERT_NE(Client, nullptr);
+  JobSlot Implicit = Client->tryAcquire();
+  JobSlot Explicit = Client->tryAcquire();
+  EXPECT_TRUE(Implicit.isImplicit());
+  EXPECT_TRUE(Explicit.isExplicit());
+  // The fifo is empty now, and reading it must not block.
+  EXPECT_FALSE(Client->tryAcquire().isValid());
+  Client->release(std::move(Explicit));
+  Client->release(std::move(Implicit));
+  Client.reset();
+
+  char Buf[2];
+  EXPECT_EQ(::read(WriteFD, Buf, sizeof(Buf)), 1);
+  ::close(WriteFD);
+
+  EXPECT_EQ(JobserverClient::create(("--jobserver-auth=fifo:" + Dir).str()),
+            nullptr);
+  ASSERT_FALSE(sys::fs::remove(Fifo));
+  ASSERT_FALSE(sys::fs::remove(Dir));
+}
+
+#endif // LLVM_ON_UNIX
+
+} // namespace
@@ -87,6 +87,9 @@ LogicalResult readBytecodeFile(llvm::MemoryBufferRef buffer, Block *block,
 /// An overload with a source manager whose main file buffer is used for
 /// parsing. The lifetime of the source manager may be freely extended during
 /// parsing such that the source manager is not destroyed before the parsed IR.
+/// Because of this, dialect resource blobs are referenced in place instead of
+/// being copied; with a memory-mapped buffer, large resources such as weights
+/// are only paged in when they are actually read.
 LogicalResult
 readBytecodeFile(const std::shared_ptr<llvm::SourceMgr> &sourceMgr,
                  Block *block, const ParserConfig &config);
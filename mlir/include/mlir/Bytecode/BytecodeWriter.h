@@ -189,6 +189,11 @@ private:
 /// Write the bytecode for the given operation to the provided output stream.
 /// For streams where it matters, the given stream should be in "binary" mode.
 /// It only ever fails if setDesiredByteCodeVersion can't be honored.
+/// Dialect resource blobs are not copied while encoding: they are written to
+/// `os` straight from the buffers that own them, padded to their requested
+/// alignment so that a reader can use them in place from a mapped file.
+/// Writing to a file stream therefore avoids holding a second copy of large
+/// resources in memory.
 LogicalResult writeBytecodeToFile(Operation *op, raw_ostream &os,
                                   const BytecodeWriterConfig &config = {});
 
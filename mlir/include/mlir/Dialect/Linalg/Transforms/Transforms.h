@@ -191,7 +191,9 @@ using TileSizeComputationFunction =
 struct LinalgTilingOptions {
   /// Computation function that returns the tile sizes for each operation.
   /// Delayed construction of constant tile sizes should occur to interoperate
-  /// with folding.
+  /// with folding. This is the hook for target-specific tile size selection:
+  /// the callback sees the op, so it can derive sizes from its shape together
+  /// with cache and vector parameters, e.g. from the DLTI target description.
   TileSizeComputationFunction tileSizeComputationFunction = nullptr;
 
   LinalgTilingOptions &
@@ -1414,6 +1414,12 @@ LLVM_ENABLE_BITMASK_ENUMS_IN_NAMESPACE();
 
 /// A unique fingerprint for a specific operation, and all of it's internal
 /// operations (if `includeNested` is set).
+///
+/// The fingerprint hashes the addresses of operations, blocks and values along
+/// with their uniqued attributes and locations. It identifies whether a given
+/// piece of IR changed in place, e.g. across a pass, but two structurally
+/// identical operations, or the same IR in another context or process, get
+/// different fingerprints, so it cannot key a cache of compilation results.
 class OperationFingerPrint {
 public:
   OperationFingerPrint(Operation *topOp, bool includeNested = true);
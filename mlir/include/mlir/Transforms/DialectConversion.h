@@ -1238,6 +1238,10 @@ struct ConversionConfig {
   /// modifications from the conversion driver. Use this flag to ensure that
   /// your patterns do not trigger any IR rollbacks. For details, see
   /// https://discourse.llvm.org/t/rfc-a-new-one-shot-dialect-conversion-driver/79083.
+  ///
+  /// Note that disabling rollback does not yet make conversions cheaper: the
+  /// driver still records every IR modification as a rewrite object and
+  /// applies them at the end, exactly as in rollback mode.
   bool allowPatternRollback = true;
 };
 
@@ -975,9 +975,12 @@ wouldCreateWriteToNonWritableBuffer(OpOperand &operand,
 const llvm::SetVector<Value> &
 OneShotAnalysisState::findDefinitionsCached(OpOperand *opOperand) {
   Value value = opOperand->get();
-  if (!cachedDefinitions.count(value))
-    cachedDefinitions[value] = findDefinitions(opOperand);
-  return cachedDefinitions[value];
+  auto it = cachedDefinitions.find(value);
+  if (it != cachedDefinitions.end())
+    return it->second;
+  SetVector<Value> definitions = findDefinitions(opOperand);
+  return cachedDefinitions.try_emplace(value, std::move(definitions))
+      .first->second;
 }
 
 void OneShotAnalysisState::resetCache() {
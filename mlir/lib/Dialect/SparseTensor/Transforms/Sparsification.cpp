@@ -798,7 +798,10 @@ static void genExpand(CodegenEnv &env, OpBuilder &builder, LoopId curr,
 /// operation that is marked "parallel" is a candidate. Whether it is actually
 /// converted to a parallel operation depends on the requested strategy.
 static bool isParallelFor(CodegenEnv &env, bool isOuter, bool isSparse) {
-  // Reject parallelization of sparse output.
+  // Reject parallelization of sparse output. Insertions into a sparse output
+  // must arrive in lexicographic order along its compressed levels, which a
+  // parallel loop cannot guarantee without per-thread buffers and a final
+  // merge that the generated code does not have.
   if (env.hasSparseOutput())
     return false;
   // Parallel loops on tensor expansion can cause data races.
@@ -366,7 +366,14 @@ extern "C" bool mlirAsyncRuntimeIsGroupError(AsyncGroup *group) {
   return group->numErrors.load() > 0;
 }
 
+// Tokens and values never leave a terminal state, so an awaiter that observes
+// one can skip the mutex. This is safe against the token or value being freed
+// under a concurrent `setTokenState`/`setValueState`, because those hold their
+// own reference until after they release the lock.
+
 extern "C" void mlirAsyncRuntimeAwaitToken(AsyncToken *token) {
+  if (State(token->state).isAvailableOrError())
+    return;
   std::unique_lock<std::mutex> lock(token->mu);
   if (!State(token->state).isAvailableOrError())
     token->cv.wait(
@@ -374,6 +381,8 @@ extern "C" void mlirAsyncRuntimeAwaitToken(AsyncToken *token) {
 }
 
 extern "C" void mlirAsyncRuntimeAwaitValue(AsyncValue *value) {
+  if (State(value->state).isAvailableOrError())
+    return;
   std::unique_lock<std::mutex> lock(value->mu);
   if (!State(value->state).isAvailableOrError())
     value->cv.wait(
@@ -401,6 +410,8 @@ extern "C" void mlirAsyncRuntimeAwaitTokenAndExecute(AsyncToken *token,
                                                      CoroHandle handle,
                                                      CoroResume resume) {
   auto execute = [handle, resume]() { (*resume)(handle); };
+  if (State(token->state).isAvailableOrError())
+    return execute();
   std::unique_lock<std::mutex> lock(token->mu);
   if (State(token->state).isAvailableOrError()) {
     lock.unlock();
@@ -414,6 +425,8 @@ extern "C" void mlirAsyncRuntimeAwaitValueAndExecute(AsyncValue *value,
                                                      CoroHandle handle,
                                                      CoroResume resume) {
   auto execute = [handle, resume]() { (*resume)(handle); };
+  if (State(value->state).isAvailableOrError())
+    return execute();
   std::unique_lock<std::mutex> lock(value->mu);
   if (State(value->state).isAvailableOrError()) {
     lock.unlock();
@@ -488,13 +488,16 @@ LogicalResult detail::verifySymbolTable(Operation *op) {
     return op->emitOpError()
            << "Operations with a 'SymbolTable' must have exactly one block";
 
-  // Check that all symbols are uniquely named within child regions.
+  // Check that all symbols are uniquely named within child regions. Look up
+  // the symbol name through its uniqued identifier, as the SymbolTable
+  // constructor does, rather than by string for every nested operation.
+  StringAttr symbolNameId = StringAttr::get(op->getContext(),
+                                            SymbolTable::getSymbolAttrName());
   DenseMap<Attribute, Location> nameToOrigLoc;
   for (auto &block : op->getRegion(0)) {
     for (auto &op : block) {
       // Check for a symbol name attribute.
-      auto nameAttr =
-          op.getAttrOfType<StringAttr>(mlir::SymbolTable::getSymbolAttrName());
+      StringAttr nameAttr = getNameIfSymbol(&op, symbolNameId);
       if (!nameAttr)
         continue;
 
@@ -11,7 +11,10 @@
 #include "mlir/Support/LLVM.h"
 #include "mlir/Support/ThreadLocalCache.h"
 #include "mlir/Support/TypeID.h"
+#include "llvm/Support/MathExtras.h"
 #include "llvm/Support/RWMutex.h"
+#include "llvm/Support/Threading.h"
+#include <algorithm>
 
 using namespace mlir;
 using namespace mlir::detail;
@@ -375,12 +378,24 @@ auto StorageUniquer::getParametricStorageTypeImpl(
   return impl->getOrCreate(id, hashValue, isEqual, ctorFn);
 }
 
+/// Return the number of shards to use for each parametric uniquer. With more
+/// threads than shards, hot storage types (e.g. array or elements attributes)
+/// keep colliding on the same shard lock. Shards are allocated lazily, so
+/// providing one per hardware thread only costs a pointer per unused shard.
+static size_t getNumParametricUniquerShards() {
+  static const size_t numShards = std::clamp<size_t>(
+      llvm::PowerOf2Ceil(llvm::hardware_concurrency().compute_thread_count()),
+      8, 128);
+  return numShards;
+}
+
 /// Implementation for registering an instance of a derived type with
 /// parametric storage.
 void StorageUniquer::registerParametricStorageTypeImpl(
     TypeID id, function_ref<void(BaseStorage *)> destructorFn) {
   impl->parametricUniquers.try_emplace(
-      id, std::make_unique<ParametricStorageUniquer>(destructorFn));
+      id, std::make_unique<ParametricStorageUniquer>(
+              destructorFn, getNumParametricUniquerShards()));
 }
 
 /// Implementation for getting an instance of a derived type with default
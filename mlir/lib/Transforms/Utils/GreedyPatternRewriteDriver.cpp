@@ -317,6 +317,12 @@ private:
 /// This abstract class manages the worklist and contains helper methods for
 /// rewriting ops on the worklist. Derived classes specify how ops are added
 /// to the worklist in the beginning.
+///
+/// The driver is single-threaded: patterns are not required to be thread-safe,
+/// and a rewrite may erase or move ops anywhere within the scope, so the
+/// worklist cannot be split between threads. Parallelism over regions that are
+/// isolated from above comes from the pass manager instead, by nesting the
+/// pass that runs this driver on those isolated ops.
 class GreedyPatternRewriteDriver : public RewriterBase::Listener {
 protected:
   explicit GreedyPatternRewriteDriver(MLIRContext *ctx,
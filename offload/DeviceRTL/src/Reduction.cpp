@@ -174,6 +174,13 @@ int32_t __kmpc_nvptx_parallel_reduce_nowait_v2(IdentTy *Loc,
   return nvptx_parallel_reduce_nowait(reduce_data, shflFct, cpyFct);
 }
 
+// Cross-team reduction. Each team master stores (or folds) its partial result
+// into one of num_of_records slots of GlobalBuffer and then does a single
+// atomic increment of the team counter. The team that observes the final count
+// reduces all slots in parallel, one slot per thread, finishing with warp
+// shuffles, so no team spins on a global atomic per element. More slots let
+// more teams proceed without waiting for a chunk to drain; the count is set
+// with -fopenmp-cuda-teams-reduction-recs-num.
 int32_t __kmpc_nvptx_teams_reduce_nowait_v2(
     IdentTy *Loc, void *GlobalBuffer, uint32_t num_of_records,
     uint64_t reduce_data_size, void *reduce_data, ShuffleReductFnTy shflFct,